@@ -61,6 +61,19 @@ std::string stringified_float_list(size_t n = FLOAT_DATA_N,
     return oss.str();
 }
 
+// Like stringified_float_list, but with all the significant digits of Float
+template <typename Float>
+std::string stringified_precise_float_list(size_t n = FLOAT_DATA_N,
+                                           const char* delim = " ")
+{
+    std::ostringstream oss;
+    oss.precision(std::numeric_limits<Float>::digits10);
+    for (size_t i = 0; i < n; ++i) {
+        oss << generate_single_float<Float>() << delim;
+    }
+    return oss.str();
+}
+
 inline int scanf_float(const char* ptr, float& f)
 {
     return sscanf(ptr, "%f", &f);
@@ -41,6 +41,32 @@ static void scan_float_repeated_scn(benchmark::State& state)
 }
 BENCHMARK_TEMPLATE(scan_float_repeated_scn, float);
 BENCHMARK_TEMPLATE(scan_float_repeated_scn, double);
+BENCHMARK_TEMPLATE(scan_float_repeated_scn, long double);
+
+template <typename Float>
+static void scan_float_repeated_scn_precise(benchmark::State& state)
+{
+    auto data = stringified_precise_float_list<Float>();
+    Float f{};
+    auto result = scn::make_result(data);
+    for (auto _ : state) {
+        result = scn::scan(result.range(), "{}", f);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(sizeof(Float)));
+}
+BENCHMARK_TEMPLATE(scan_float_repeated_scn_precise, double);
+BENCHMARK_TEMPLATE(scan_float_repeated_scn_precise, long double);
 
 template <typename Float>
 static void scan_float_repeated_scn_default(benchmark::State& state)
@@ -43,6 +43,33 @@ BENCHMARK_TEMPLATE(scan_int_repeated_scn, int);
 BENCHMARK_TEMPLATE(scan_int_repeated_scn, long long);
 BENCHMARK_TEMPLATE(scan_int_repeated_scn, unsigned);
 
+// Every value on its own line, indented by 24 spaces
+template <typename Int>
+static void scan_int_repeated_scn_padded(benchmark::State& state)
+{
+    auto data = stringified_integer_list<Int>(
+        INT_DATA_N, "\n                        ");
+    Int i{};
+    auto result = scn::make_result(data);
+    for (auto _ : state) {
+        result = scn::scan(result.range(), "{}", i);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+    }
+    state.SetBytesProcessed(state.iterations() *
+                            static_cast<int64_t>(sizeof(Int)));
+}
+BENCHMARK_TEMPLATE(scan_int_repeated_scn_padded, int);
+BENCHMARK_TEMPLATE(scan_int_repeated_scn_padded, long long);
+
 template <typename Int>
 static void scan_int_repeated_scn_default(benchmark::State& state)
 {
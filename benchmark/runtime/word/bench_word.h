@@ -136,4 +136,19 @@ inline scn::wstring_view default_format_str<wchar_t>()
     return {L"{}"};
 }
 
+template <typename Char>
+inline scn::basic_string_view<Char> set_format_str()
+{
+}
+template <>
+inline scn::string_view set_format_str<char>()
+{
+    return {" {:[a-zA-Z0-9_]}"};
+}
+template <>
+inline scn::wstring_view set_format_str<wchar_t>()
+{
+    return {L" {:[a-zA-Z0-9_]}"};
+}
+
 #endif  // SCN_BENCHMARK_WORD_H
@@ -161,6 +161,37 @@ static void scan_word_repeated_scn_view_default(benchmark::State& state)
 BENCHMARK_TEMPLATE(scan_word_repeated_scn_view_default, char);
 BENCHMARK_TEMPLATE(scan_word_repeated_scn_view_default, wchar_t);
 
+template <typename Char>
+static void scan_word_repeated_scn_view_set(benchmark::State& state)
+{
+    auto data = word_list<Char>(WORD_DATA_N);
+    scn::basic_string_view<Char> str{};
+    auto result = scn::make_result(data);
+    size_t size = 0;
+    for (auto _ : state) {
+        result = scn::scan(result.range(), set_format_str<Char>(), str);
+
+        if (!result) {
+            // Leading whitespace in the format string makes an empty
+            // range an invalid_format_string error, not end_of_range
+            if (result.error() == scn::error::end_of_range ||
+                result.range().empty()) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        else {
+            size += str.size();
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size * sizeof(Char)));
+}
+BENCHMARK_TEMPLATE(scan_word_repeated_scn_view_set, char);
+BENCHMARK_TEMPLATE(scan_word_repeated_scn_view_set, wchar_t);
+
 template <typename Char>
 static void scan_word_repeated_scn_view_value(benchmark::State& state)
 {
@@ -190,6 +221,34 @@ static void scan_word_repeated_scn_view_value(benchmark::State& state)
 BENCHMARK_TEMPLATE(scan_word_repeated_scn_view_value, char);
 BENCHMARK_TEMPLATE(scan_word_repeated_scn_view_value, wchar_t);
 
+template <typename Char>
+static void getline_repeated_scn(benchmark::State& state)
+{
+    auto data = word_list<Char>(WORD_DATA_N);
+    scn::basic_string_view<Char> str{};
+    auto result = scn::make_result(data);
+    size_t size = 0;
+    for (auto _ : state) {
+        result = scn::getline(result.range(), str);
+
+        if (!result) {
+            if (result.error() == scn::error::end_of_range) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        else {
+            size += str.size();
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size * sizeof(Char)));
+}
+BENCHMARK_TEMPLATE(getline_repeated_scn, char);
+BENCHMARK_TEMPLATE(getline_repeated_scn, wchar_t);
+
 template <typename Char>
 static void scan_word_repeated_sstream(benchmark::State& state)
 {
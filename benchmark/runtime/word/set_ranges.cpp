@@ -0,0 +1,87 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#include "bench_word.h"
+
+#include <algorithm>
+
+// CJK, kana, hangul, and emoji: 13 ranges after merging
+static const wchar_t* const set_ranges_format_str =
+    L" {:[\\u3040-\\u309f\\u30a0-\\u30ff\\u3100-\\u312f\\u3130-\\u318f"
+    L"\\u31f0-\\u31ff\\u3400-\\u4dbf\\u4e00-\\u9fff\\ua960-\\ua97f"
+    L"\\uac00-\\ud7a3\\uf900-\\ufaff\\uff66-\\uff9f"
+    L"\\U0001f300-\\U0001f5ff\\U0001f600-\\U0001f64f"
+    L"\\U0001f680-\\U0001f6ff\\U0001f900-\\U0001f9ff"
+    L"\\U00020000-\\U0002a6df]}";
+
+// Words of `len` characters from the set, separated by spaces.
+// Only BMP characters are used, so that the data is the same
+// with a 16-bit wchar_t
+static std::wstring set_ranges_word_list(size_t len, size_t n)
+{
+    static const wchar_t chars[] = {0x3042, 0x30ab, 0x3105, 0x3131,
+                                    0x4e00, 0x4e8c, 0x65e5, 0x672c,
+                                    0x8a9e, 0x9f8d, 0xac00, 0xd55c,
+                                    0xf900, 0xff71, 0x3400, 0xa960};
+    static std::uniform_int_distribution<> dist(
+        0, static_cast<int>(sizeof(chars) / sizeof(chars[0]) - 1));
+
+    std::wstring ret;
+    ret.reserve(n);
+    while (ret.size() + len + 1 <= n) {
+        for (size_t i = 0; i < len; ++i) {
+            ret.push_back(chars[static_cast<size_t>(dist(get_rng()))]);
+        }
+        ret.push_back(L' ');
+    }
+    return ret;
+}
+
+static void scan_word_set_ranges_scn(benchmark::State& state)
+{
+    const auto len = static_cast<size_t>(state.range(0));
+    auto data = set_ranges_word_list(len, std::max(len + 1, size_t{2 << 14}));
+    scn::wstring_view str{};
+    auto result = scn::make_result(data);
+    size_t size = 0;
+    for (auto _ : state) {
+        result = scn::scan(result.range(), set_ranges_format_str, str);
+
+        if (!result) {
+            // Leading whitespace in the format string makes an empty
+            // range an invalid_format_string error, not end_of_range
+            if (result.error() == scn::error::end_of_range ||
+                result.range().empty()) {
+                result = scn::make_result(data);
+            }
+            else {
+                state.SkipWithError("Benchmark errored");
+                break;
+            }
+        }
+        else {
+            size += str.size();
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(size * sizeof(wchar_t)));
+}
+BENCHMARK(scan_word_set_ranges_scn)
+    ->Arg(4)
+    ->Arg(8)
+    ->Arg(32)
+    ->Arg(256)
+    ->Arg(4096);
@@ -78,6 +78,9 @@ namespace scn {
             uint_type,
             ulong_type,
             ulong_long_type,
+            // 128-bit integers, if SCN_HAS_INT128
+            int128_type,
+            uint128_type,
             // other integral types
             bool_type,
             char_type,
@@ -231,6 +234,11 @@ namespace scn {
         SCN_MAKE_VALUE(ulong_type, unsigned long)
         SCN_MAKE_VALUE(ulong_long_type, unsigned long long)
 
+#if SCN_HAS_INT128
+        SCN_MAKE_VALUE(int128_type, int128)
+        SCN_MAKE_VALUE(uint128_type, uint128)
+#endif
+
         SCN_MAKE_VALUE(bool_type, bool)
         SCN_MAKE_VALUE(code_point_type, code_point)
 
@@ -359,6 +367,13 @@ namespace scn {
             case detail::ulong_long_type:
                 return vis(arg.m_value.template get_as<unsigned long long>());
 
+#if SCN_HAS_INT128
+            case detail::int128_type:
+                return vis(arg.m_value.template get_as<detail::int128>());
+            case detail::uint128_type:
+                return vis(arg.m_value.template get_as<detail::uint128>());
+#endif
+
             case detail::bool_type:
                 return vis(arg.m_value.template get_as<bool>());
             case detail::char_type:
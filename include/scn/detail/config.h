@@ -112,6 +112,23 @@
 #define SCN_WINDOWS 0
 #endif
 
+// 128-bit integers
+#ifndef SCN_HAS_INT128
+#if defined(__SIZEOF_INT128__) && !SCN_MSVC
+#define SCN_HAS_INT128 1
+#else
+#define SCN_HAS_INT128 0
+#endif
+#endif
+
+// Byte order
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && \
+    __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define SCN_IS_BIG_ENDIAN 1
+#else
+#define SCN_IS_BIG_ENDIAN 0
+#endif
+
 #ifdef _MSVC_LANG
 #define SCN_MSVC_LANG _MSVC_LANG
 #else
@@ -339,6 +356,15 @@
 #define SCN_HAS_LAUNDER 0
 #endif
 
+// Detect strtod_l and friends, taking a locale_t (_locale_t on MSVC)
+#ifndef SCN_HAS_STRTOD_L
+#if SCN_MSVC || defined(__GLIBC__) || SCN_APPLE || defined(__FreeBSD__)
+#define SCN_HAS_STRTOD_L 1
+#else
+#define SCN_HAS_STRTOD_L 0
+#endif
+#endif
+
 // Detect __assume
 #if SCN_INTEL || SCN_MSVC
 #define SCN_HAS_ASSUME 1
@@ -19,9 +19,12 @@
 #define SCN_DETAIL_FILE_H
 
 #include <cstdio>
+#include <cstring>
+#include <memory>
 #include <string>
 
 #include "../util/algorithm.h"
+#include "../util/expected.h"
 #include "range.h"
 
 namespace scn {
@@ -40,19 +43,32 @@ namespace scn {
             handle_type handle;
         };
 
+        /**
+         * Reads up to `n` bytes from `h` into `buf`.
+         * Reads interrupted by a signal are retried.
+         * May read less than `n` bytes, even if not at EOF.
+         *
+         * \return Number of bytes read, `0` at EOF
+         */
+        expected<size_t> read_native_file(native_file_handle h,
+                                          void* buf,
+                                          size_t n);
+
         class byte_mapped_file {
         public:
             using iterator = const char*;
             using sentinel = const char*;
 
             byte_mapped_file() = default;
-            explicit byte_mapped_file(const char* filename);
+            explicit byte_mapped_file(const char* filename,
+                                      unsigned hints = 0);
 
             byte_mapped_file(const byte_mapped_file&) = delete;
             byte_mapped_file& operator=(const byte_mapped_file&) = delete;
 
             byte_mapped_file(byte_mapped_file&& o) noexcept
                 : m_map(exchange(o.m_map, span<char>{})),
+                  m_released(exchange(o.m_released, size_t{0})),
                   m_file(exchange(o.m_file, native_file_handle::invalid()))
             {
 #if SCN_WINDOWS
@@ -69,6 +85,7 @@ namespace scn {
                 }
 
                 m_map = exchange(o.m_map, span<char>{});
+                m_released = exchange(o.m_released, size_t{0});
                 m_file = exchange(o.m_file, native_file_handle::invalid());
 #if SCN_WINDOWS
                 m_map_handle =
@@ -103,8 +120,11 @@ namespace scn {
 
         protected:
             void _destruct();
+            void _release_until(size_t n);
 
             span<char> m_map{};
+            // Bytes from the beginning of m_map released by release_until
+            size_t m_released{0};
             native_file_handle m_file{native_file_handle::invalid().handle};
 #if SCN_WINDOWS
             native_file_handle m_map_handle{
@@ -113,6 +133,21 @@ namespace scn {
         };
     }  // namespace detail
 
+    /**
+     * Hints for memory-mapping a file with `basic_mapped_file`, combined with
+     * `|`. Ignored where not supported by the platform.
+     */
+    enum mapped_file_hints : unsigned {
+        /// The file will be read sequentially: read ahead aggressively
+        map_sequential = 1,
+        /// Read the whole file into memory when mapping it, instead of
+        /// faulting pages in one by one on first access
+        map_populate = 2,
+        /// Align the mapping to the huge page size, and ask for it to be
+        /// backed by huge pages
+        map_huge_pages = 4
+    };
+
     /**
      * Memory-mapped file range.
      * Manages the lifetime of the mapping itself.
@@ -130,6 +165,14 @@ namespace scn {
         explicit basic_mapped_file(const char* f) : detail::byte_mapped_file{f}
         {
         }
+        /**
+         * Constructs a mapping to a filename, with `hints`: a combination of
+         * `mapped_file_hints`
+         */
+        basic_mapped_file(const char* f, unsigned hints)
+            : detail::byte_mapped_file{f, hints}
+        {
+        }
 
         SCN_NODISCARD iterator begin() const noexcept
         {
@@ -156,6 +199,26 @@ namespace scn {
             return {data(), size()};
         }
 
+        /**
+         * Releases the pages before `it` from memory (release-behind), so that
+         * a sequential scan over a large file doesn't keep every page it has
+         * read resident.
+         * Reading from these pages again is still possible, but they have to
+         * be read from the file again.
+         *
+         * \code{.cpp}
+         * auto result = scn::make_result(file);
+         * while ((result = scn::scan(result.range(), ...))) {
+         *     file.release_until(result.range().begin());
+         * }
+         * \endcode
+         */
+        void release_until(iterator it)
+        {
+            SCN_EXPECT(it >= begin() && it <= end());
+            _release_until(static_cast<size_t>(it - begin()) * sizeof(CharT));
+        }
+
         detail::range_wrapper<basic_string_view<CharT>> wrap() const noexcept
         {
             return basic_string_view<CharT>{data(), size()};
@@ -165,6 +228,283 @@ namespace scn {
     using mapped_file = basic_mapped_file<char>;
     using mapped_wfile = basic_mapped_file<wchar_t>;
 
+    namespace detail {
+        class byte_windowed_mapped_file {
+        public:
+            /// Default size of a mapped window, in bytes
+            static constexpr size_t default_window_size = 64 * 1024 * 1024;
+
+            byte_windowed_mapped_file() = default;
+            explicit byte_windowed_mapped_file(
+                const char* filename,
+                size_t window_size = default_window_size);
+
+            byte_windowed_mapped_file(const byte_windowed_mapped_file&) =
+                delete;
+            byte_windowed_mapped_file& operator=(
+                const byte_windowed_mapped_file&) = delete;
+
+            byte_windowed_mapped_file(byte_windowed_mapped_file&& o) noexcept
+                : m_map(exchange(o.m_map, span<char>{})),
+                  m_map_offset(exchange(o.m_map_offset, size_t{0})),
+                  m_file_size(exchange(o.m_file_size, size_t{0})),
+                  m_window_size(o.m_window_size),
+                  m_granularity(o.m_granularity),
+                  m_file(exchange(o.m_file, native_file_handle::invalid()))
+            {
+#if SCN_WINDOWS
+                m_map_handle =
+                    exchange(o.m_map_handle, native_file_handle::invalid());
+#endif
+            }
+            byte_windowed_mapped_file& operator=(
+                byte_windowed_mapped_file&& o) noexcept
+            {
+                if (valid()) {
+                    _destruct();
+                }
+
+                m_map = exchange(o.m_map, span<char>{});
+                m_map_offset = exchange(o.m_map_offset, size_t{0});
+                m_file_size = exchange(o.m_file_size, size_t{0});
+                m_window_size = o.m_window_size;
+                m_granularity = o.m_granularity;
+                m_file = exchange(o.m_file, native_file_handle::invalid());
+#if SCN_WINDOWS
+                m_map_handle =
+                    exchange(o.m_map_handle, native_file_handle::invalid());
+#endif
+                return *this;
+            }
+
+            ~byte_windowed_mapped_file()
+            {
+                if (valid()) {
+                    _destruct();
+                }
+            }
+
+            SCN_NODISCARD bool valid() const
+            {
+                return m_file.handle != native_file_handle::invalid().handle;
+            }
+
+            /// Size of the file, in bytes
+            SCN_NODISCARD size_t file_size() const noexcept
+            {
+                return m_file_size;
+            }
+            /// Size of a mapped window, in bytes
+            SCN_NODISCARD size_t window_size() const noexcept
+            {
+                return m_window_size;
+            }
+
+        protected:
+            // Maps a window containing the bytes [offset, offset + n),
+            // replacing the current one
+            error _map_window(size_t offset, size_t n) const;
+            void _unmap() const;
+            void _destruct();
+
+            // Currently mapped window
+            mutable span<char> m_map{};
+            // File offset of m_map[0]
+            mutable size_t m_map_offset{0};
+            size_t m_file_size{0};
+            size_t m_window_size{default_window_size};
+            // Alignment of a window in the file
+            size_t m_granularity{1};
+            native_file_handle m_file{native_file_handle::invalid().handle};
+#if SCN_WINDOWS
+            native_file_handle m_map_handle{
+                native_file_handle::invalid().handle};
+#endif
+        };
+    }  // namespace detail
+
+    /**
+     * Memory-mapped file range, mapping only a window of the file at a time.
+     * Use instead of `basic_mapped_file` for files too large to map into
+     * the address space at once.
+     *
+     * The window is moved forward as scanning advances: every successful
+     * scan from this range marks the characters it read as consumed, and
+     * the next window starts from the first unconsumed character.
+     * If the characters of a single scan don't fit in a window, a larger
+     * window is mapped.
+     *
+     * The contents of the current window are available through
+     * `get_buffer()`, without copying. Unlike `basic_mapped_file`, the range
+     * is not contiguous.
+     */
+    template <typename CharT>
+    class basic_windowed_mapped_file
+        : public detail::byte_windowed_mapped_file {
+    public:
+        class iterator {
+        public:
+            using char_type = CharT;
+            using value_type = expected<CharT>;
+            using reference = value_type;
+            using pointer = value_type*;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::bidirectional_iterator_tag;
+            using file_type = basic_windowed_mapped_file<CharT>;
+
+            iterator() = default;
+
+            expected<CharT> operator*() const
+            {
+                SCN_EXPECT(m_file);
+                return m_file->_get_char_at(m_current);
+            }
+
+            iterator& operator++()
+            {
+                SCN_EXPECT(m_file);
+                ++m_current;
+                return *this;
+            }
+            iterator operator++(int)
+            {
+                iterator tmp(*this);
+                operator++();
+                return tmp;
+            }
+
+            iterator& operator--()
+            {
+                SCN_EXPECT(m_file);
+                // Characters before the window have been released
+                SCN_EXPECT(m_current > m_file->m_window_begin);
+                --m_current;
+                return *this;
+            }
+            iterator operator--(int)
+            {
+                iterator tmp(*this);
+                operator--();
+                return tmp;
+            }
+
+            bool operator==(const iterator& o) const
+            {
+                return m_current == o.m_current;
+            }
+            bool operator!=(const iterator& o) const
+            {
+                return !operator==(o);
+            }
+
+            void reset_begin_iterator() const noexcept
+            {
+                m_current = m_file ? m_file->m_window_begin : 0;
+            }
+
+            /**
+             * Marks the characters before this iterator as consumed,
+             * allowing the window to be moved past them.
+             */
+            void mark_consumed() const noexcept
+            {
+                if (m_file && m_current > m_file->m_window_begin) {
+                    m_file->m_window_begin = m_current;
+                }
+            }
+
+        private:
+            friend class basic_windowed_mapped_file;
+
+            iterator(const file_type& f, size_t i)
+                : m_file{std::addressof(f)}, m_current{i}
+            {
+            }
+
+            const file_type* m_file{nullptr};
+            mutable size_t m_current{0};
+        };
+
+        using sentinel = iterator;
+        using char_type = CharT;
+
+        /// Constructs an empty mapping
+        basic_windowed_mapped_file() = default;
+
+        /**
+         * Opens a file, to be mapped `window_size` bytes at a time.
+         * `window_size` is rounded up to the page size (allocation
+         * granularity on Windows).
+         */
+        explicit basic_windowed_mapped_file(
+            const char* f,
+            size_t window_size = default_window_size)
+            : detail::byte_windowed_mapped_file{f, window_size}
+        {
+        }
+
+        iterator begin() const noexcept
+        {
+            return {*this, m_window_begin};
+        }
+        sentinel end() const noexcept
+        {
+            return {*this, size()};
+        }
+
+        /// Size of the file, in characters
+        SCN_NODISCARD size_t size() const noexcept
+        {
+            return m_file_size / sizeof(CharT);
+        }
+
+        span<const CharT> get_buffer(iterator it,
+                                     size_t max_size) const noexcept
+        {
+            const auto first = m_map_offset / sizeof(CharT);
+            const auto last = first + m_map.size() / sizeof(CharT);
+            if (!it.m_file || it.m_current < first || it.m_current >= last) {
+                return {};
+            }
+            return {_window_data() + (it.m_current - first),
+                    detail::min(max_size, last - it.m_current)};
+        }
+
+    private:
+        friend class iterator;
+
+        const CharT* _window_data() const noexcept
+        {
+            // embrace the UB
+            return reinterpret_cast<const CharT*>(m_map.data());
+        }
+
+        expected<CharT> _get_char_at(size_t i) const
+        {
+            SCN_EXPECT(valid());
+            SCN_EXPECT(i < size());
+            SCN_EXPECT(i >= m_window_begin);
+
+            const auto first = m_map_offset / sizeof(CharT);
+            if (i < first || i >= first + m_map.size() / sizeof(CharT)) {
+                // Map from the first character still reachable,
+                // to keep the current scan in a single window
+                const auto begin = m_window_begin * sizeof(CharT);
+                auto e = _map_window(begin, (i + 1) * sizeof(CharT) - begin);
+                if (!e) {
+                    return e;
+                }
+            }
+            return _window_data()[i - m_map_offset / sizeof(CharT)];
+        }
+
+        // Iterator index of begin()
+        mutable size_t m_window_begin{0};
+    };
+
+    using windowed_mapped_file = basic_windowed_mapped_file<char>;
+    using windowed_mapped_wfile = basic_windowed_mapped_file<wchar_t>;
+
     namespace detail {
         template <typename CharT>
         struct basic_file_access;
@@ -214,7 +554,8 @@ namespace scn {
             iterator& operator--()
             {
                 SCN_EXPECT(m_file);
-                SCN_EXPECT(m_current > 0);
+                // Characters before m_offset have been released
+                SCN_EXPECT(m_current > m_file->m_offset);
 
                 m_last_error = error{};
                 --m_current;
@@ -262,7 +603,20 @@ namespace scn {
 
             void reset_begin_iterator() const noexcept
             {
-                m_current = 0;
+                m_current = m_file ? m_file->m_window_begin : 0;
+            }
+
+            /**
+             * Marks the characters before this iterator as consumed.
+             * Only has an effect if the file is windowed.
+             *
+             * \see basic_file::set_windowed
+             */
+            void mark_consumed() const noexcept
+            {
+                if (m_file) {
+                    m_file->_release_until(m_current);
+                }
             }
 
         private:
@@ -291,13 +645,27 @@ namespace scn {
          * Must be a valid handle that can be read from.
          */
         basic_file(FILE* f) : m_file{f} {}
+        /**
+         * Construct from a FILE*, reading in blocks of `block_size`
+         * characters.
+         *
+         * \see set_block_size
+         */
+        basic_file(FILE* f, size_t block_size)
+            : m_file{f}, m_block_size{block_size}
+        {
+        }
 
         basic_file(const basic_file&) = delete;
         basic_file& operator=(const basic_file&) = delete;
 
         basic_file(basic_file&& o) noexcept
             : m_buffer(detail::exchange(o.m_buffer, {})),
-              m_file(detail::exchange(o.m_file, nullptr))
+              m_file(detail::exchange(o.m_file, nullptr)),
+              m_block_size(o.m_block_size),
+              m_offset(detail::exchange(o.m_offset, size_t{0})),
+              m_window_begin(detail::exchange(o.m_window_begin, size_t{0})),
+              m_windowed(o.m_windowed)
         {
         }
         basic_file& operator=(basic_file&& o) noexcept
@@ -307,6 +675,10 @@ namespace scn {
             }
             m_buffer = detail::exchange(o.m_buffer, {});
             m_file = detail::exchange(o.m_file, nullptr);
+            m_block_size = o.m_block_size;
+            m_offset = detail::exchange(o.m_offset, size_t{0});
+            m_window_begin = detail::exchange(o.m_window_begin, size_t{0});
+            m_windowed = o.m_windowed;
             return *this;
         }
 
@@ -350,6 +722,58 @@ namespace scn {
             return m_file != nullptr;
         }
 
+        /**
+         * Number of characters read from the FILE* at a time.
+         * `0` or `1` means unbuffered: characters are read one at a time with
+         * `std::fgetc`.
+         */
+        size_t block_size() const noexcept
+        {
+            return m_block_size;
+        }
+        /**
+         * Read up to `n` characters from the FILE* at a time, with
+         * `std::fread`, instead of reading them one by one.
+         * This makes large blocks available through `get_buffer()`, which
+         * speeds up scanning considerably.
+         *
+         * A read may block until a whole block is available, so this is not
+         * suitable for interactive input.
+         * Characters read past the scanned input are only given back to the
+         * FILE* by `sync(iterator)`.
+         * On POSIX, narrow files are synced by seeking back, if the FILE* is
+         * seekable. Otherwise the characters are put back with
+         * `std::ungetc` or `std::ungetwc`, which the C standard only
+         * guarantees for a single character: with a non-seekable FILE*
+         * (a pipe or a terminal), or with a wide file, block mode is only
+         * correct if the C library supports unlimited putback, like glibc
+         * does.
+         */
+        void set_block_size(size_t n) noexcept
+        {
+            m_block_size = n;
+        }
+
+        /// Whether the file is windowed
+        bool windowed() const noexcept
+        {
+            return m_windowed;
+        }
+        /**
+         * If `true`, every successful scan from this file marks the
+         * characters it read as consumed: `begin()` will start after them,
+         * and `sync()` only gives back the characters not consumed.
+         *
+         * Consumed characters are also discarded from the internal buffer, so
+         * that its size is bounded by the largest single scan, not by the
+         * size of the input.
+         * Iterators pointing before `begin()` are invalidated.
+         */
+        void set_windowed(bool w) noexcept
+        {
+            m_windowed = w;
+        }
+
         /**
          * Synchronizes this file with the underlying FILE*.
          * Invalidates all non-end iterators.
@@ -375,12 +799,38 @@ namespace scn {
         void sync() noexcept
         {
             _sync_all();
-            m_buffer.clear();
+            _clear_buffer();
+        }
+        /**
+         * Synchronizes this file with the underlying FILE*, so that the next
+         * read from the FILE* starts at `it`.
+         * Characters read from the FILE*, but not consumed up until `it`, are
+         * given back to it, either by seeking or by putting them back.
+         * Invalidates all non-end iterators.
+         * File must be open.
+         *
+         * Necessary for syncing a file with a block size.
+         *
+         * \code{.cpp}
+         * auto result = scn::scan(file, ...);
+         * file.sync(result.range().begin());
+         * result.range().reset_begin_iterator();
+         * \endcode
+         */
+        void sync(iterator it) noexcept
+        {
+            // Characters before the window have already been released
+            SCN_EXPECT(!it.m_file || it.m_current >= m_window_begin);
+            const auto end = m_offset + m_buffer.size();
+            _sync_until(
+                it.m_file ? detail::min(it.m_current, end) - m_offset
+                          : m_buffer.size());
+            _clear_buffer();
         }
 
         iterator begin() const noexcept
         {
-            return {*this, 0};
+            return {*this, m_window_begin};
         }
         sentinel end() const noexcept
         {
@@ -393,8 +843,10 @@ namespace scn {
             if (!it.m_file) {
                 return {};
             }
+            SCN_EXPECT(it.m_current >= m_offset);
             const auto begin =
-                m_buffer.begin() + static_cast<std::ptrdiff_t>(it.m_current);
+                m_buffer.begin() +
+                static_cast<std::ptrdiff_t>(it.m_current - m_offset);
             const auto end_diff = detail::min(
                 max_size,
                 static_cast<size_t>(ranges::distance(begin, m_buffer.end())));
@@ -405,28 +857,69 @@ namespace scn {
         friend class iterator;
 
         expected<CharT> _read_single() const;
+        expected<CharT> _read_block() const;
+
+        expected<CharT> _read_next() const
+        {
+            if (m_block_size > 1) {
+                return _read_block();
+            }
+            return _read_single();
+        }
 
         void _sync_all() noexcept
         {
-            _sync_until(m_buffer.size());
+            _sync_until(m_windowed ? m_window_begin - m_offset
+                                   : m_buffer.size());
         }
+        // pos is relative to the beginning of m_buffer
         void _sync_until(size_t pos) noexcept;
 
+        void _clear_buffer() noexcept
+        {
+            m_buffer.clear();
+            m_offset = 0;
+            m_window_begin = 0;
+        }
+
+        void _release_until(size_t i) const noexcept
+        {
+            if (!m_windowed || i <= m_window_begin) {
+                return;
+            }
+            m_window_begin = detail::min(i, m_offset + m_buffer.size());
+
+            // Only discard once at least half of the buffer is consumed,
+            // so that the unconsumed tail is moved an amortized O(1) times
+            const auto n = m_window_begin - m_offset;
+            if (n >= m_buffer.size() - n) {
+                m_buffer.erase(0, n);
+                m_offset = m_window_begin;
+            }
+        }
+
         CharT _get_char_at(size_t i) const
         {
             SCN_EXPECT(valid());
-            SCN_EXPECT(i < m_buffer.size());
-            return m_buffer[i];
+            SCN_EXPECT(i >= m_offset);
+            SCN_EXPECT(i - m_offset < m_buffer.size());
+            return m_buffer[i - m_offset];
         }
 
         bool _is_at_end(size_t i) const
         {
             SCN_EXPECT(valid());
-            return i >= m_buffer.size();
+            return i >= m_offset + m_buffer.size();
         }
 
         mutable std::basic_string<CharT> m_buffer{};
         FILE* m_file{nullptr};
+        size_t m_block_size{0};
+        // Index of m_buffer[0], in characters read since the last sync
+        mutable size_t m_offset{0};
+        // Iterator index of begin(), when windowed
+        mutable size_t m_window_begin{0};
+        bool m_windowed{false};
     };
 
     using file = basic_file<char>;
@@ -446,6 +939,10 @@ namespace scn {
     template <>
     expected<wchar_t> wfile::_read_single() const;
     template <>
+    expected<char> file::_read_block() const;
+    template <>
+    expected<wchar_t> wfile::_read_block() const;
+    template <>
     void file::_sync_until(size_t) noexcept;
     template <>
     void wfile::_sync_until(size_t) noexcept;
@@ -525,6 +1022,346 @@ namespace scn {
     using owning_file = basic_owning_file<char>;
     using owning_wfile = basic_owning_file<wchar_t>;
 
+    /**
+     * Range reading directly from a native file handle (a file descriptor on
+     * POSIX, a `HANDLE` on Windows), without going through <cstdio>.
+     * Works with pipes and other sources that can't be memory-mapped.
+     *
+     * Characters are read in large blocks into a buffer, which can be
+     * supplied by the caller, and are available through `get_buffer()`.
+     * Every successful scan from this range marks the characters it read as
+     * consumed: `begin()` will start after them, and their space in the buffer
+     * is reused. If the characters of a single scan don't fit in a
+     * caller-supplied buffer, a larger one is allocated.
+     *
+     * Doesn't own the handle. Not copyable or reconstructible.
+     */
+    template <typename CharT>
+    class basic_fd_range {
+    public:
+        class iterator {
+        public:
+            using char_type = CharT;
+            using value_type = expected<CharT>;
+            using reference = value_type;
+            using pointer = value_type*;
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::bidirectional_iterator_tag;
+            using range_type = basic_fd_range<CharT>;
+
+            iterator() = default;
+
+            expected<CharT> operator*() const
+            {
+                SCN_EXPECT(m_range);
+                return m_range->_get_char_at(m_current);
+            }
+
+            iterator& operator++()
+            {
+                SCN_EXPECT(m_range);
+                ++m_current;
+                return *this;
+            }
+            iterator operator++(int)
+            {
+                iterator tmp(*this);
+                operator++();
+                return tmp;
+            }
+
+            iterator& operator--()
+            {
+                SCN_EXPECT(m_range);
+                // Characters before the window have been released
+                SCN_EXPECT(m_current > m_range->m_window_begin);
+                --m_current;
+                return *this;
+            }
+            iterator operator--(int)
+            {
+                iterator tmp(*this);
+                operator--();
+                return tmp;
+            }
+
+            bool operator==(const iterator& o) const
+            {
+                if (m_range && o.m_range) {
+                    SCN_EXPECT(m_range == o.m_range);
+                    return m_current == o.m_current;
+                }
+                // null iterator is the end iterator
+                if (m_range) {
+                    return m_range->_is_at_end(m_current);
+                }
+                if (o.m_range) {
+                    return o.m_range->_is_at_end(o.m_current);
+                }
+                return true;
+            }
+            bool operator!=(const iterator& o) const
+            {
+                return !operator==(o);
+            }
+
+            void reset_begin_iterator() const noexcept
+            {
+                m_current = m_range ? m_range->m_window_begin : 0;
+            }
+
+            /**
+             * Marks the characters before this iterator as consumed,
+             * allowing them to be discarded from the buffer.
+             */
+            void mark_consumed() const noexcept
+            {
+                if (m_range) {
+                    m_range->_release_until(m_current);
+                }
+            }
+
+        private:
+            friend class basic_fd_range;
+
+            iterator(const range_type& r, size_t i)
+                : m_range{std::addressof(r)}, m_current{i}
+            {
+            }
+
+            const range_type* m_range{nullptr};
+            mutable size_t m_current{0};
+        };
+
+        using sentinel = iterator;
+        using char_type = CharT;
+
+        /// Size of the internal buffer, if one isn't supplied, in characters
+        static constexpr size_t default_buffer_size = 65536 / sizeof(CharT);
+
+        /**
+         * Construct an empty range.
+         * Reading not possible: valid() is `false`
+         */
+        basic_fd_range() = default;
+        /**
+         * Construct from a native file handle.
+         * Must be a valid handle that can be read from.
+         * Reads into an internal buffer of `buffer_size` characters,
+         * allocated on the first read.
+         */
+        explicit basic_fd_range(detail::native_file_handle h,
+                                size_t buffer_size = default_buffer_size)
+            : m_handle{h}, m_capacity_hint{buffer_size}
+        {
+            SCN_EXPECT(buffer_size > 0);
+        }
+        /**
+         * Construct from a native file handle, reading into `buf`.
+         * `buf` must outlive this range.
+         */
+        basic_fd_range(detail::native_file_handle h, span<CharT> buf)
+            : m_data{buf.data()},
+              m_capacity{buf.size()},
+              m_handle{h},
+              m_capacity_hint{buf.size()}
+        {
+            SCN_EXPECT(buf.size() > 0);
+        }
+
+        basic_fd_range(const basic_fd_range&) = delete;
+        basic_fd_range& operator=(const basic_fd_range&) = delete;
+
+        basic_fd_range(basic_fd_range&& o) noexcept
+            : m_owned(SCN_MOVE(o.m_owned)),
+              m_data(detail::exchange(o.m_data, nullptr)),
+              m_size(detail::exchange(o.m_size, size_t{0})),
+              m_capacity(detail::exchange(o.m_capacity, size_t{0})),
+              m_partial(detail::exchange(o.m_partial, size_t{0})),
+              m_offset(detail::exchange(o.m_offset, size_t{0})),
+              m_window_begin(detail::exchange(o.m_window_begin, size_t{0})),
+              m_error(detail::exchange(o.m_error, error{})),
+              m_handle(detail::exchange(o.m_handle,
+                                        detail::native_file_handle::invalid())),
+              m_capacity_hint(o.m_capacity_hint)
+        {
+        }
+        basic_fd_range& operator=(basic_fd_range&& o) noexcept
+        {
+            m_owned = SCN_MOVE(o.m_owned);
+            m_data = detail::exchange(o.m_data, nullptr);
+            m_size = detail::exchange(o.m_size, size_t{0});
+            m_capacity = detail::exchange(o.m_capacity, size_t{0});
+            m_partial = detail::exchange(o.m_partial, size_t{0});
+            m_offset = detail::exchange(o.m_offset, size_t{0});
+            m_window_begin = detail::exchange(o.m_window_begin, size_t{0});
+            m_error = detail::exchange(o.m_error, error{});
+            m_handle = detail::exchange(o.m_handle,
+                                        detail::native_file_handle::invalid());
+            m_capacity_hint = o.m_capacity_hint;
+            return *this;
+        }
+
+        ~basic_fd_range() = default;
+
+        /// Get the native handle for this range
+        detail::native_file_handle handle() const noexcept
+        {
+            return m_handle;
+        }
+
+        /// Whether the range has a handle to read from
+        bool valid() const noexcept
+        {
+            return m_handle.handle !=
+                   detail::native_file_handle::invalid().handle;
+        }
+
+        iterator begin() const noexcept
+        {
+            return {*this, m_window_begin};
+        }
+        sentinel end() const noexcept
+        {
+            return {};
+        }
+
+        span<const CharT> get_buffer(iterator it,
+                                     size_t max_size) const noexcept
+        {
+            const auto end = m_offset + m_size;
+            if (!it.m_range || it.m_current >= end) {
+                return {};
+            }
+            SCN_EXPECT(it.m_current >= m_offset);
+            const auto begin = m_data + (it.m_current - m_offset);
+            return {begin, detail::min(max_size, end - it.m_current)};
+        }
+
+    private:
+        friend class iterator;
+
+        expected<CharT> _get_char_at(size_t i) const
+        {
+            SCN_EXPECT(valid());
+            SCN_EXPECT(i >= m_offset);
+            while (i >= m_offset + m_size) {
+                auto e = _read_block();
+                if (!e) {
+                    return e;
+                }
+            }
+            return m_data[i - m_offset];
+        }
+
+        bool _is_at_end(size_t i) const
+        {
+            SCN_EXPECT(valid());
+            if (i < m_offset + m_size) {
+                return false;
+            }
+            // Other errors are returned when dereferencing
+            return _read_block().code() == error::end_of_range;
+        }
+
+        void _release_until(size_t i) const noexcept
+        {
+            // The space is reclaimed on the next read
+            if (i > m_window_begin) {
+                m_window_begin = detail::min(i, m_offset + m_size);
+            }
+        }
+
+        // Makes room for more characters after m_data[m_size]
+        void _reserve() const
+        {
+            if (m_capacity != m_size && m_capacity - m_size >= m_capacity / 2) {
+                return;
+            }
+
+            // Discard consumed characters
+            const auto consumed = m_window_begin - m_offset;
+            if (consumed != 0) {
+                std::memmove(
+                    m_data, m_data + consumed,
+                    (m_size - consumed) * sizeof(CharT) + m_partial);
+                m_size -= consumed;
+                m_offset = m_window_begin;
+            }
+
+            if (m_capacity != m_size && m_capacity - m_size >= m_capacity / 4) {
+                return;
+            }
+            const auto cap = detail::max(m_capacity * 2, m_capacity_hint);
+            auto buf = std::unique_ptr<CharT[]>(new CharT[cap]);
+            if (m_size != 0 || m_partial != 0) {
+                std::memcpy(buf.get(), m_data,
+                            m_size * sizeof(CharT) + m_partial);
+            }
+            m_owned = SCN_MOVE(buf);
+            m_data = m_owned.get();
+            m_capacity = cap;
+        }
+
+        error _read_block() const
+        {
+            SCN_EXPECT(valid());
+            if (!m_error) {
+                // EOF or an error has already been encountered
+                return m_error;
+            }
+
+            _reserve();
+            SCN_GCC_PUSH
+            SCN_GCC_IGNORE("-Wcast-align")
+            // A short read may leave a partial character at the end,
+            // completed by the next read
+            auto dest = reinterpret_cast<char*>(m_data + m_size) + m_partial;
+            SCN_GCC_POP
+            const auto n = (m_capacity - m_size) * sizeof(CharT) - m_partial;
+            auto ret = detail::read_native_file(m_handle, dest, n);
+            if (!ret) {
+                m_error = ret.error();
+                return m_error;
+            }
+            if (ret.value() == 0) {
+                if (m_partial != 0) {
+                    m_error = error(error::invalid_encoding,
+                                    "Incomplete character at EOF");
+                }
+                else {
+                    m_error = error(error::end_of_range, "EOF");
+                }
+                return m_error;
+            }
+
+            const auto bytes = m_partial + ret.value();
+            m_size += bytes / sizeof(CharT);
+            m_partial = bytes % sizeof(CharT);
+            return {};
+        }
+
+        mutable std::unique_ptr<CharT[]> m_owned{};
+        mutable CharT* m_data{nullptr};
+        // Characters in m_data
+        mutable size_t m_size{0};
+        mutable size_t m_capacity{0};
+        // Bytes of an incomplete character after m_data[m_size - 1]
+        mutable size_t m_partial{0};
+        // Index of m_data[0], in characters read from the handle
+        mutable size_t m_offset{0};
+        // Iterator index of begin()
+        mutable size_t m_window_begin{0};
+        // Sticky EOF or read error
+        mutable error m_error{};
+        detail::native_file_handle m_handle{
+            detail::native_file_handle::invalid().handle};
+        size_t m_capacity_hint{default_buffer_size};
+    };
+
+    using fd_range = basic_fd_range<char>;
+    using wfd_range = basic_fd_range<wchar_t>;
+
     SCN_CLANG_PUSH
     SCN_CLANG_IGNORE("-Wexit-time-destructors")
 
@@ -109,6 +109,11 @@ namespace scn {
         struct simple_integer_scanner;
     }
 
+    // reader/int.h
+
+    template <typename T, unsigned Scale>
+    struct fixed_point;
+
     // visitor.h
 
     template <typename Context, typename ParseCtx>
@@ -119,9 +124,13 @@ namespace scn {
     template <typename CharT>
     class basic_mapped_file;
     template <typename CharT>
+    class basic_windowed_mapped_file;
+    template <typename CharT>
     class basic_file;
     template <typename CharT>
     class basic_owning_file;
+    template <typename CharT>
+    class basic_fd_range;
 
     // scan.h
 
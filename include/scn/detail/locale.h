@@ -23,6 +23,8 @@
 #include "../util/string_view.h"
 #include "../util/unique_ptr.h"
 
+#include <cstdint>
+#include <cstring>
 #include <cwchar>
 #include <string>
 
@@ -93,6 +95,113 @@ namespace scn {
             return cp == 0x20 || (cp >= 0x09 && cp <= 0x0d);
         }
 
+        // SWAR (SIMD within a register) whitespace classification:
+        // returns a mask with the high bit set in every byte of v,
+        // for which is_space() would return true.
+        // Every byte is tested separately: no carries cross byte boundaries.
+        inline uint64_t space_mask_swar(uint64_t v) noexcept
+        {
+            constexpr uint64_t high = 0x8080808080808080;
+            constexpr uint64_t low7 = 0x7f7f7f7f7f7f7f7f;
+            constexpr uint64_t ones = 0x0101010101010101;
+
+            // low7 bits of every byte + c never carries into the next byte
+            const auto m = v & low7;
+            // '\t' (0x09) <= byte <= '\r' (0x0d)
+            const auto ge_tab = m + (0x80 - 0x09) * ones;
+            const auto gt_cr = m + (0x80 - 0x0e) * ones;
+            const auto control = ge_tab & ~gt_cr & ~v;
+            // byte == ' ': zero after xor
+            const auto x = v ^ (0x20 * ones);
+            const auto space = ~(((x & low7) + low7) | x | low7);
+            return (control | space) & high;
+        }
+
+        // Index of the first byte in memory order, that has its high bit
+        // set in mask (as returned by space_mask_swar). mask must not be 0.
+        inline std::ptrdiff_t first_marked_byte(uint64_t mask) noexcept
+        {
+            SCN_EXPECT(mask != 0);
+#if SCN_IS_BIG_ENDIAN
+            std::ptrdiff_t i = 0;
+            for (; (mask & 0x8000000000000000) == 0; mask <<= 8) {
+                ++i;
+            }
+            return i;
+#elif SCN_GCC_COMPAT
+            return __builtin_ctzll(mask) / 8;
+#else
+            std::ptrdiff_t i = 0;
+            for (; (mask & 0x80) == 0; mask >>= 8) {
+                ++i;
+            }
+            return i;
+#endif
+        }
+
+        // Returns the first non-space character in [it, end),
+        // according to the static locale.
+        // Checks eight characters at a time with space_mask_swar.
+        inline const char* find_first_non_space(const char* it,
+                                                const char* end) noexcept
+        {
+            // Values are usually separated by a single space:
+            // check the first characters one at a time,
+            // the SWAR loop only pays off for longer runs
+            for (int i = 0; i < 2; ++i, ++it) {
+                if (it == end || !is_space(*it)) {
+                    return it;
+                }
+            }
+            for (; end - it >= 8; it += 8) {
+                uint64_t v;
+                std::memcpy(&v, it, sizeof(uint64_t));
+                const auto non_space =
+                    ~space_mask_swar(v) & 0x8080808080808080;
+                if (non_space != 0) {
+                    return it + first_marked_byte(non_space);
+                }
+            }
+            for (; it != end && is_space(*it); ++it) {}
+            return it;
+        }
+        inline const wchar_t* find_first_non_space(const wchar_t* it,
+                                                   const wchar_t* end) noexcept
+        {
+            for (; it != end && is_space(*it); ++it) {}
+            return it;
+        }
+
+        // Returns the first space character in [it, end),
+        // according to the static locale.
+        // Checks eight characters at a time with space_mask_swar.
+        inline const char* find_first_space(const char* it,
+                                            const char* end) noexcept
+        {
+            // Short words are found faster one character at a time
+            for (int i = 0; i < 8; ++i, ++it) {
+                if (it == end || is_space(*it)) {
+                    return it;
+                }
+            }
+            for (; end - it >= 8; it += 8) {
+                uint64_t v;
+                std::memcpy(&v, it, sizeof(uint64_t));
+                const auto space = space_mask_swar(v);
+                if (space != 0) {
+                    return it + first_marked_byte(space);
+                }
+            }
+            for (; it != end && !is_space(*it); ++it) {}
+            return it;
+        }
+        inline const wchar_t* find_first_space(const wchar_t* it,
+                                               const wchar_t* end) noexcept
+        {
+            for (; it != end && !is_space(*it); ++it) {}
+            return it;
+        }
+
         constexpr inline bool is_digit(char ch) noexcept
         {
             return ch >= '0' && ch <= '9';
@@ -367,6 +476,35 @@ namespace scn {
             }
         };
 
+        /**
+         * Rules for reading numbers in a locale, extracted once from its
+         * `ctype` and `numpunct` facets.
+         */
+        template <typename CharT>
+        struct localized_number_format {
+            // "0123456789abcdefABCDEF", widened with ctype
+            CharT digits[22];
+            CharT plus_sign;
+            CharT minus_sign;
+            CharT thousands_separator;
+            // numpunct::grouping(), empty if digits aren't grouped
+            std::string grouping;
+            // true, if the digits and signs are the same as in "C"
+            bool is_ascii;
+
+            // Returns the value of ch as a digit (0-15),
+            // or 255 if ch is not a digit
+            unsigned char digit_value(CharT ch) const
+            {
+                for (unsigned char i = 0; i < 22; ++i) {
+                    if (digits[i] == ch) {
+                        return i < 16 ? i : static_cast<unsigned char>(i - 6);
+                    }
+                }
+                return 255;
+            }
+        };
+
         // custom
         template <typename CharT>
         class basic_custom_locale_ref final
@@ -438,6 +576,8 @@ namespace scn {
                                               const string_type& buf,
                                               int base) const;
 
+            const localized_number_format<CharT>& number_format() const;
+
         private:
             SCN_CLANG_PUSH_IGNORE_UNDEFINED_TEMPLATE
             bool do_is_space(char_type ch) const override;
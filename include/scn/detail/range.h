@@ -59,6 +59,37 @@ namespace scn {
                 static_const<detail::_reset_begin_iterator::fn>::value;
         }
 
+        namespace _mark_consumed {
+            struct fn {
+            private:
+                template <typename Iterator>
+                static auto impl(const Iterator& it, priority_tag<1>) noexcept(
+                    noexcept(it.mark_consumed()))
+                    -> decltype(it.mark_consumed())
+                {
+                    return it.mark_consumed();
+                }
+
+                template <typename Iterator>
+                static void impl(const Iterator&, priority_tag<0>) noexcept
+                {
+                }
+
+            public:
+                template <typename Iterator>
+                auto operator()(const Iterator& it) const
+                    noexcept(noexcept(fn::impl(it, priority_tag<1>{})))
+                        -> decltype(fn::impl(it, priority_tag<1>{}))
+                {
+                    return fn::impl(it, priority_tag<1>{});
+                }
+            };
+        }  // namespace _mark_consumed
+        namespace {
+            static constexpr auto& mark_consumed =
+                static_const<detail::_mark_consumed::fn>::value;
+        }
+
         template <typename Iterator, typename = void>
         struct extract_char_type;
         template <typename Iterator>
@@ -84,6 +115,27 @@ namespace scn {
             : std::is_integral<ranges::range_value_t<const Range>> {
         };
 
+        // Iterators into a borrowed range don't point into the range object
+        // itself, so they stay valid when it's copied or moved.
+        // Being a view isn't enough: owning_view, single_view, or any copyable
+        // type the ranges polyfill considers a view, may own its elements.
+        template <typename Range>
+        struct is_borrowed_range_impl
+#if SCN_USE_STD_RANGES
+            : std::integral_constant<bool,
+                                     std::ranges::borrowed_range<Range>> {
+#else
+            : std::false_type {
+#endif
+        };
+        template <typename CharT>
+        struct is_borrowed_range_impl<basic_string_view<CharT>>
+            : std::true_type {
+        };
+        template <typename T>
+        struct is_borrowed_range_impl<span<T>> : std::true_type {
+        };
+
         template <typename Range>
         struct reconstruct_tag {
         };
@@ -201,41 +253,32 @@ namespace scn {
 
             range_wrapper(const range_wrapper& o) : m_range(o.m_range)
             {
-                const auto n =
-                    ranges::distance(o.begin_underlying(), o.m_begin);
-                m_begin = ranges::cbegin(m_range.get());
-                ranges::advance(m_begin, n);
+                _rebind_begin(o, o._begin_offset());
                 m_read = o.m_read;
             }
             range_wrapper& operator=(const range_wrapper& o)
             {
-                const auto n =
-                    ranges::distance(o.begin_underlying(), o.m_begin);
+                const auto n = o._begin_offset();
                 m_range = o.m_range;
-                m_begin = ranges::cbegin(m_range.get());
-                ranges::advance(m_begin, n);
+                _rebind_begin(o, n);
                 m_read = o.m_read;
                 return *this;
             }
 
             range_wrapper(range_wrapper&& o) noexcept
             {
-                const auto n =
-                    ranges::distance(o.begin_underlying(), o.m_begin);
+                const auto n = o._begin_offset();
                 m_range = SCN_MOVE(o.m_range);
-                m_begin = ranges::cbegin(m_range.get());
-                ranges::advance(m_begin, n);
+                _rebind_begin(o, n);
                 m_read = exchange(o.m_read, 0);
             }
             range_wrapper& operator=(range_wrapper&& o) noexcept
             {
                 reset_to_rollback_point();
 
-                const auto n =
-                    ranges::distance(o.begin_underlying(), o.m_begin);
+                const auto n = o._begin_offset();
                 m_range = SCN_MOVE(o.m_range);
-                m_begin = ranges::cbegin(m_range.get());
-                ranges::advance(m_begin, n);
+                _rebind_begin(o, n);
                 m_read = exchange(o.m_read, 0);
                 return *this;
             }
@@ -320,7 +363,7 @@ namespace scn {
              * Note that `range_underlying().begin()` may not be equal to
              * `begin()`.
              */
-            const range_type& range_underlying() const noexcept
+            const range_nocvref_type& range_underlying() const noexcept
             {
                 return m_range.get();
             }
@@ -396,12 +439,15 @@ namespace scn {
             }
             /**
              * Sets the rollback point equal to the current `begin()` iterator.
+             * Characters before it can no longer be reached by rolling back,
+             * so the source range is allowed to discard them.
              *
              * \see reset_to_rollback_point()
              */
             void set_rollback_point()
             {
                 m_read = 0;
+                detail::mark_consumed(m_begin);
             }
 
             void reset_begin_iterator()
@@ -443,6 +489,49 @@ namespace scn {
                 provides_buffer_access_impl<range_nocvref_type>::value;
 
         private:
+            // Iterators into a range stored by reference, or into a borrowed
+            // range, stay valid when the storage is copied or moved.
+            // Other ranges may own their elements, so `m_begin` has to be
+            // recreated from the offset.
+            using carries_iterator = std::integral_constant<
+                bool,
+                std::is_reference<Range>::value ||
+                    is_borrowed_range_impl<range_nocvref_type>::value>;
+
+            // Offset of m_begin, needed by _rebind_begin;
+            // read before o.m_range is moved from
+            difference_type _begin_offset() const
+            {
+                return _begin_offset(carries_iterator{});
+            }
+            difference_type _begin_offset(std::true_type) const noexcept
+            {
+                return 0;
+            }
+            difference_type _begin_offset(std::false_type) const
+            {
+                return ranges::distance(begin_underlying(), m_begin);
+            }
+
+            // Call after m_range has been copied or moved from o.m_range
+            void _rebind_begin(const range_wrapper& o, difference_type n)
+            {
+                _rebind_begin(o, n, carries_iterator{});
+            }
+            void _rebind_begin(const range_wrapper& o,
+                               difference_type,
+                               std::true_type)
+            {
+                m_begin = o.m_begin;
+            }
+            void _rebind_begin(const range_wrapper&,
+                               difference_type n,
+                               std::false_type)
+            {
+                m_begin = ranges::cbegin(m_range.get());
+                ranges::advance(m_begin, n);
+            }
+
             template <typename R = Range>
             bool _advance_check(std::ptrdiff_t n, std::true_type)
             {
@@ -1286,7 +1286,7 @@ namespace scn {
                 auto _test_requires(I i,
                                     const I j,
                                     const custom_ranges::iter_difference_t<I> n)
-                    -> decltype(valid_expr(
+                    -> decltype(scn::detail::valid_expr(
                         j + n,
                         custom_ranges::detail::requires_expr<
                             std::is_same<decltype(j + n), I>::value>{},
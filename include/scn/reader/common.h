@@ -24,6 +24,9 @@
 #include "../unicode/unicode.h"
 #include "../util/algorithm.h"
 
+#include <cstring>
+#include <cwchar>
+
 namespace scn {
     SCN_BEGIN_NAMESPACE
 
@@ -184,6 +187,12 @@ namespace scn {
                 return read_code_point_result<CharT>{sbuf.first(1),
                                                      make_code_point(sbuf[0])};
             }
+            if (sbuf.data() != writebuf.data()) {
+                // Code point continues past the buffer:
+                // the rest is read into writebuf
+                std::copy(sbuf.begin(), sbuf.end(), writebuf.begin());
+                sbuf = writebuf.first(sbuf.size());
+            }
             while (sbuf.ssize() < len) {
                 auto ret = read_code_unit(r, true);
                 if (!ret) {
@@ -559,6 +568,88 @@ namespace scn {
     // read_until_space_zero_copy
 
     namespace detail {
+        template <typename CharT>
+        struct is_space_predicate;
+        template <typename CharT>
+        struct until_pred;
+
+        // Returns the first ch in [first, last), or last if none found
+        inline const char* find_code_unit(const char* first,
+                                          const char* last,
+                                          char ch)
+        {
+            const auto p = std::memchr(first, static_cast<unsigned char>(ch),
+                                       static_cast<size_t>(last - first));
+            return p != nullptr ? static_cast<const char*>(p) : last;
+        }
+        inline const wchar_t* find_code_unit(const wchar_t* first,
+                                             const wchar_t* last,
+                                             wchar_t ch)
+        {
+            const auto p =
+                std::wmemchr(first, ch, static_cast<size_t>(last - first));
+            return p != nullptr ? p : last;
+        }
+
+        template <typename WrappedRange, typename Predicate>
+        expected<span<const typename WrappedRange::char_type>>
+        read_until_space_contiguous(WrappedRange& r,
+                                    Predicate& is_space,
+                                    bool keep_final_space)
+        {
+            return detail::read_until_pred_contiguous(r, is_space, true,
+                                                      keep_final_space);
+        }
+        template <typename WrappedRange, typename CharT>
+        expected<span<const CharT>> read_until_space_contiguous(
+            WrappedRange& r,
+            is_space_predicate<CharT>& is_space,
+            bool keep_final_space)
+        {
+            if (is_space.is_localized() || is_space.is_width_limited()) {
+                return detail::read_until_pred_contiguous(
+                    r, is_space, true, keep_final_space);
+            }
+
+            // Static locale, no width:
+            // search for the space directly, many characters at a time
+            if (r.begin() == r.end()) {
+                return error(error::end_of_range, "EOF");
+            }
+            const auto begin = r.data();
+            const auto end = begin + r.size();
+            auto it = find_first_space(begin, end);
+            if (keep_final_space && it != end) {
+                ++it;
+            }
+            r.advance_to(r.begin() + (it - begin));
+            return span<const CharT>{begin, it};
+        }
+        template <typename WrappedRange, typename CharT>
+        expected<span<const CharT>> read_until_space_contiguous(
+            WrappedRange& r,
+            until_pred<CharT>& until,
+            bool keep_final_space)
+        {
+            if (until.is_multibyte()) {
+                return detail::read_until_pred_contiguous(r, until, true,
+                                                          keep_final_space);
+            }
+
+            // Single code unit: search for it with memchr
+            if (r.begin() == r.end()) {
+                return error(error::end_of_range, "EOF");
+            }
+            const auto begin = r.data();
+            const auto end = begin + r.size();
+            auto it = find_code_unit(begin, end, until.until[0]);
+            if (keep_final_space && it != end) {
+                ++it;
+            }
+            r.advance_to(r.begin() + (it - begin));
+            return span<const CharT>{begin, it};
+        }
+
         template <typename WrappedRange, typename Predicate>
         expected<span<const typename WrappedRange::char_type>>
         read_until_space_zero_copy_impl(WrappedRange& r,
@@ -566,8 +657,7 @@ namespace scn {
                                         bool keep_final_space,
                                         std::true_type)
         {
-            return detail::read_until_pred_contiguous(r, SCN_FWD(is_space),
-                                                      true, keep_final_space);
+            return read_until_space_contiguous(r, is_space, keep_final_space);
         }
         template <typename WrappedRange, typename Predicate>
         expected<span<const typename WrappedRange::char_type>>
@@ -625,6 +715,70 @@ namespace scn {
     // read_until_space
 
     namespace detail {
+        // Reads the code units in s into out, until pred returns
+        // pred_result_to_stop (done = true), or out_cmp(out) returns false.
+        // Returns the position in s where reading stopped.
+        template <typename CharT,
+                  typename Predicate,
+                  typename OutputIt,
+                  typename OutputItCmp>
+        const CharT* read_until_pred_in_buffer(span<const CharT> s,
+                                               Predicate& pred,
+                                               bool pred_result_to_stop,
+                                               OutputIt& out,
+                                               OutputItCmp& out_cmp,
+                                               bool keep_final,
+                                               bool& done)
+        {
+            auto it = s.begin();
+            for (; it != s.end() && out_cmp(out); ++it) {
+                if (pred(make_span(&*it, 1)) == pred_result_to_stop) {
+                    if (keep_final) {
+                        *out = *it;
+                        ++out;
+                        ++it;
+                    }
+                    done = true;
+                    break;
+                }
+                *out = *it;
+                ++out;
+            }
+            return it;
+        }
+        template <typename CharT, typename OutputIt, typename OutputItCmp>
+        const CharT* read_until_pred_in_buffer(span<const CharT> s,
+                                               until_pred<CharT>& until,
+                                               bool pred_result_to_stop,
+                                               OutputIt& out,
+                                               OutputItCmp& out_cmp,
+                                               bool keep_final,
+                                               bool& done)
+        {
+            SCN_EXPECT(pred_result_to_stop);
+            SCN_EXPECT(!until.is_multibyte());
+            SCN_UNUSED(pred_result_to_stop);
+
+            // Single code unit: search for it with memchr,
+            // and only then copy what's before it
+            const auto found =
+                find_code_unit(s.begin(), s.end(), until.until[0]);
+            auto it = s.begin();
+            for (; it != found && out_cmp(out); ++it) {
+                *out = *it;
+                ++out;
+            }
+            if (it != s.end() && it == found && out_cmp(out)) {
+                if (keep_final) {
+                    *out = *it;
+                    ++out;
+                    ++it;
+                }
+                done = true;
+            }
+            return it;
+        }
+
         template <typename WrappedRange,
                   typename Predicate,
                   typename OutputIt,
@@ -638,26 +792,19 @@ namespace scn {
                                      bool& done,
                                      std::true_type)
         {
+            // r is only advanced past what's consumed from the buffer:
+            // putting characters back may be expensive
             if (!pred.is_multibyte()) {
                 while (r.begin() != r.end() && !done) {
-                    auto s = r.get_buffer_and_advance();
-                    for (auto it = s.begin(); it != s.end() && out_cmp(out);
-                         ++it) {
-                        if (pred(make_span(&*it, 1)) == pred_result_to_stop) {
-                            if (keep_final) {
-                                *out = *it;
-                                ++out;
-                            }
-                            auto e =
-                                putback_n(r, ranges::distance(it, s.end()));
-                            if (!e) {
-                                return e;
-                            }
-                            done = true;
-                            break;
-                        }
-                        *out = *it;
-                        ++out;
+                    auto s = get_buffer(r.range_underlying(), r.begin());
+                    auto it = read_until_pred_in_buffer(
+                        s, pred, pred_result_to_stop, out, out_cmp, keep_final,
+                        done);
+                    r.advance(ranges::distance(s.begin(), it));
+                    if (!out_cmp(out)) {
+                        // Nothing more can be read
+                        done = true;
+                        break;
                     }
                     if (!done && out_cmp(out)) {
                         auto ret = read_code_unit(r, false);
@@ -685,18 +832,17 @@ namespace scn {
             }
             else {
                 while (r.begin() != r.end() && !done) {
-                    auto s = r.get_buffer_and_advance();
-                    for (auto it = s.begin(); it != s.end() && out_cmp(out);) {
+                    auto s = get_buffer(r.range_underlying(), r.begin());
+                    auto it = s.begin();
+                    for (; it != s.end() && out_cmp(out);) {
                         auto len = ::scn::get_sequence_length(*it);
                         if (len == 0) {
                             return error{error::invalid_encoding,
                                          "Invalid code point"};
                         }
                         if (ranges::distance(it, s.end()) < len) {
-                            auto e = putback_n(r, len);
-                            if (!e) {
-                                return e;
-                            }
+                            // continues past the buffer,
+                            // read with read_code_point below
                             break;
                         }
                         auto cpspan = make_span(it, static_cast<size_t>(len));
@@ -714,11 +860,19 @@ namespace scn {
                             if (keep_final) {
                                 out = std::copy(cpspan.begin(), cpspan.end(),
                                                 out);
+                                it += len;
                             }
                             done = true;
                             break;
                         }
                         out = std::copy(cpspan.begin(), cpspan.end(), out);
+                        it += len;
+                    }
+                    r.advance(ranges::distance(s.begin(), it));
+                    if (!out_cmp(out)) {
+                        // Nothing more can be read
+                        done = true;
+                        break;
                     }
 
                     if (!done && out_cmp(out)) {
@@ -999,6 +1153,14 @@ namespace scn {
             {
                 return is_localized() && is_multichar_type(CharT{});
             }
+            /**
+             * Returns `true`, if the number of code units to read is limited
+             * by the `width` parameter given to the constructor
+             */
+            constexpr bool is_width_limited() const
+            {
+                return m_width != 0;
+            }
 
         private:
             using static_locale_type = typename locale_type::static_type;
@@ -1139,6 +1301,20 @@ namespace scn {
                   Context::range_type::is_contiguous>::type* = nullptr>
     error skip_range_whitespace(Context& ctx, bool localized) noexcept
     {
+        if (!localized) {
+            // Static locale: classify the characters directly,
+            // many at a time, instead of through is_space_predicate
+            auto& r = ctx.range();
+            if (r.begin() == r.end()) {
+                return {error::end_of_range, "EOF"};
+            }
+            const auto begin = r.data();
+            const auto it =
+                detail::find_first_non_space(begin, begin + r.size());
+            r.advance_to(r.begin() + (it - begin));
+            return {};
+        }
+
         auto is_space_pred =
             detail::make_is_space_predicate(ctx.locale(), localized);
         return detail::read_until_pred_contiguous(ctx.range(), is_space_pred,
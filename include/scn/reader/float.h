@@ -206,10 +206,9 @@ namespace scn {
                                                  CharT locale_decimal_point)
             {
                 size_t chars{};
-                std::basic_string<CharT> str(s.data(), s.size());
                 SCN_CLANG_PUSH_IGNORE_UNDEFINED_TEMPLATE
-                auto ret =
-                    _read_float_impl(str.data(), chars, locale_decimal_point);
+                auto ret = _read_float_impl(s.data(), s.size(), chars,
+                                            locale_decimal_point);
                 SCN_CLANG_POP_IGNORE_UNDEFINED_TEMPLATE
                 if (!ret) {
                     return ret.error();
@@ -220,6 +219,7 @@ namespace scn {
 
             template <typename CharT>
             expected<T> _read_float_impl(const CharT* str,
+                                         size_t len,
                                          size_t& chars,
                                          CharT locale_decimal_point);
         };
@@ -27,7 +27,7 @@ namespace scn {
     namespace detail {
         template <typename T>
         struct integer_scanner : common_parser {
-            static_assert(std::is_integral<T>::value,
+            static_assert(is_integer<T>::value,
                           "integer_scanner requires an integral type");
 
             friend struct simple_integer_scanner<T>;
@@ -234,45 +234,23 @@ namespace scn {
                     if (SCN_UNLIKELY((format_options & localized_digits) !=
                                      0)) {
                         SCN_CLANG_PUSH_IGNORE_UNDEFINED_TEMPLATE
-                        int b{base};
-                        auto r = parse_base_prefix<char_type>(s, b);
-                        if (!r) {
-                            return r.error();
-                        }
-                        if (b == -1) {
-                            // -1 means we read a '0'
-                            tmp = 0;
-                            return {};
-                        }
-                        if (b != 10 && base != b && base != 0) {
-                            return {error::invalid_scanned_value,
-                                    "Invalid base prefix"};
-                        }
-                        if (base == 0) {
-                            base = static_cast<uint8_t>(b);
-                        }
-                        if (base != 8 && base != 10 && base != 16) {
-                            return {error::invalid_scanned_value,
-                                    "Localized values have to be in base "
-                                    "8, 10 or 16"};
-                        }
-
-                        auto it = r.value();
-                        std::basic_string<char_type> str(to_address(it),
-                                                         s.size());
-                        ret = ctx.locale().get_localized().read_num(
-                            tmp, str, static_cast<int>(base));
-
-                        if (tmp < T{0} &&
-                            (format_options & only_unsigned) != 0) {
-                            return {error::invalid_scanned_value,
-                                    "Parsed negative value when type was 'u'"};
-                        }
+                        ret = _parse_localized_int(
+                            tmp, s,
+                            ctx.locale().get_localized().number_format());
                         SCN_CLANG_POP_IGNORE_UNDEFINED_TEMPLATE
                     }
                     else {
+                        const bool accept_thsep =
+                            (format_options & allow_thsep) != 0;
+                        auto thsep = ascii_widen<char_type>(',');
+                        if (SCN_UNLIKELY(accept_thsep)) {
+                            thsep =
+                                ctx.locale()
+                                    .get((common_options & localized) != 0)
+                                    .thousands_separator();
+                        }
                         SCN_CLANG_PUSH_IGNORE_UNDEFINED_TEMPLATE
-                        ret = _parse_int(tmp, s);
+                        ret = _parse_int(tmp, s, accept_thsep, thsep);
                         SCN_CLANG_POP_IGNORE_UNDEFINED_TEMPLATE
                     }
 
@@ -375,57 +353,16 @@ namespace scn {
                                span<const CharT>& s,
                                std::false_type)
             {
-                auto do_read = [&](Buf& b) -> error {
-                    auto outputit = std::back_inserter(b);
-                    auto is_space_pred = make_is_space_predicate(
-                        ctx.locale(), (common_options & localized) != 0,
-                        field_width);
-                    auto e = read_until_space(ctx.range(), outputit,
-                                              is_space_pred, false);
-                    if (!e && b.empty()) {
-                        return e;
-                    }
-
-                    return {};
-                };
-
-                if (SCN_LIKELY((format_options & allow_thsep) == 0)) {
-                    auto e = do_read(buf);
-                    if (!e) {
-                        return e;
-                    }
-                    s = make_span(buf.data(), buf.size());
-                    return {};
-                }
-
-                Buf tmp;
-                auto e = do_read(tmp);
-                if (!e) {
+                auto outputit = std::back_inserter(buf);
+                auto is_space_pred = make_is_space_predicate(
+                    ctx.locale(), (common_options & localized) != 0,
+                    field_width);
+                auto e = read_until_space(ctx.range(), outputit, is_space_pred,
+                                          false);
+                if (!e && buf.empty()) {
                     return e;
                 }
-                auto thsep = ctx.locale()
-                                 .get((common_options & localized) != 0)
-                                 .thousands_separator();
-
-                auto it = tmp.begin();
-                for (; it != tmp.end(); ++it) {
-                    if (*it == thsep) {
-                        for (auto it2 = it; ++it2 != tmp.end();) {
-                            *it++ = SCN_MOVE(*it2);
-                        }
-                        break;
-                    }
-                }
-
-                auto n =
-                    static_cast<std::size_t>(std::distance(tmp.begin(), it));
-                if (n == 0) {
-                    return {error::invalid_scanned_value,
-                            "Only a thousands separator found"};
-                }
-
-                buf = SCN_MOVE(tmp);
-                s = make_span(buf.data(), n);
+                s = make_span(buf.data(), buf.size());
                 return {};
             }
 
@@ -435,9 +372,7 @@ namespace scn {
                                span<const CharT>& s,
                                std::true_type)
             {
-                if (SCN_UNLIKELY((format_options & allow_thsep) != 0)) {
-                    return _read_source(ctx, buf, s, std::false_type{});
-                }
+                SCN_UNUSED(buf);
                 auto ret = read_zero_copy(
                     ctx.range(), field_width != 0
                                      ? static_cast<std::ptrdiff_t>(field_width)
@@ -454,14 +389,26 @@ namespace scn {
                 span<const CharT> s,
                 int& b) const;
 
+            // thsep is skipped between digits, if accept_thsep is true
             template <typename CharT>
-            expected<std::ptrdiff_t> _parse_int(T& val, span<const CharT> s);
+            expected<std::ptrdiff_t> _parse_int(T& val,
+                                                span<const CharT> s,
+                                                bool accept_thsep,
+                                                CharT thsep);
+
+            template <typename CharT>
+            expected<std::ptrdiff_t> _parse_localized_int(
+                T& val,
+                span<const CharT> s,
+                const localized_number_format<CharT>& fmt);
 
             template <typename CharT>
             expected<typename span<const CharT>::iterator> _parse_int_impl(
                 T& val,
                 bool minus_sign,
-                span<const CharT> buf) const;
+                span<const CharT> buf,
+                bool accept_thsep,
+                CharT thsep) const;
         };
 
         // instantiate
@@ -477,6 +424,144 @@ namespace scn {
         template struct integer_scanner<unsigned long long>;
         template struct integer_scanner<char>;
         template struct integer_scanner<wchar_t>;
+#if SCN_HAS_INT128
+        template struct integer_scanner<int128>;
+        template struct integer_scanner<uint128>;
+#endif
+
+        template <typename T>
+        struct fixed_point_scanner : common_parser {
+            static_assert(is_integer<T>::value &&
+                              !std::is_same<T, char>::value &&
+                              !std::is_same<T, wchar_t>::value,
+                          "fixed_point_scanner requires an integral type");
+
+            explicit fixed_point_scanner(uint8_t s = 0) : scale(s) {}
+
+            template <typename ParseCtx>
+            error parse(ParseCtx& pctx)
+            {
+                using char_type = typename ParseCtx::char_type;
+                return parse_common(pctx, span<const char_type>{},
+                                    span<bool>{}, null_type_cb<ParseCtx>);
+            }
+
+            template <typename Context>
+            error scan(T& val, Context& ctx)
+            {
+                using char_type = typename Context::char_type;
+
+                auto do_parse = [&](span<const char_type> s) -> error {
+                    if (s.size() == 0) {
+                        return {error::invalid_scanned_value,
+                                "Expected a fixed-point number"};
+                    }
+                    T tmp = 0;
+                    SCN_CLANG_PUSH_IGNORE_UNDEFINED_TEMPLATE
+                    auto ret = _parse_fixed_point(
+                        tmp, s,
+                        ctx.locale()
+                            .get((common_options & localized) != 0)
+                            .decimal_point());
+                    SCN_CLANG_POP_IGNORE_UNDEFINED_TEMPLATE
+                    if (!ret) {
+                        return ret.error();
+                    }
+                    if (ret.value() != s.ssize()) {
+                        auto pb =
+                            putback_n(ctx.range(), s.ssize() - ret.value());
+                        if (!pb) {
+                            return pb;
+                        }
+                    }
+                    val = tmp;
+                    return {};
+                };
+
+                if (Context::range_type::is_contiguous) {
+                    // The number ends at the first character,
+                    // that can't be a part of it: no need to look for
+                    // whitespace first
+                    auto s = read_zero_copy(
+                        ctx.range(),
+                        field_width != 0
+                            ? static_cast<std::ptrdiff_t>(field_width)
+                            : ctx.range().size());
+                    if (!s) {
+                        return s.error();
+                    }
+                    return do_parse(s.value());
+                }
+
+                auto is_space_pred = make_is_space_predicate(
+                    ctx.locale(), (common_options & localized) != 0,
+                    field_width);
+                small_vector<char_type, 32> buf;
+                auto outputit = std::back_inserter(buf);
+                auto e = read_until_space(ctx.range(), outputit, is_space_pred,
+                                          false);
+                if (!e && buf.empty()) {
+                    return e;
+                }
+
+                return do_parse(make_span(buf));
+            }
+
+            // Number of digits after the decimal point:
+            // the scanned value is multiplied by 10^scale
+            uint8_t scale;
+
+        private:
+            template <typename CharT>
+            expected<std::ptrdiff_t> _parse_fixed_point(
+                T& val,
+                span<const CharT> s,
+                CharT decimal_point) const;
+        };
+
+        template <typename T>
+        constexpr int floor_log10(T n)
+        {
+            return n < 10 ? 0 : 1 + floor_log10<T>(n / 10);
+        }
+        // Largest Scale, for which 10^Scale fits in T
+        template <typename T>
+        constexpr int max_fixed_point_scale()
+        {
+            using utype = typename make_unsigned_integer<T>::type;
+            return floor_log10<utype>(is_signed_integer<T>::value
+                                           ? static_cast<utype>(-1) / 2
+                                           : static_cast<utype>(-1));
+        }
+    }  // namespace detail
+
+    /**
+     * A decimal fixed-point number:
+     * `value` is the scanned number multiplied by `10^Scale`.
+     *
+     * Parses an optional sign, an integer part, and up to `Scale` digits
+     * after the decimal point, directly into an integer, without a round
+     * trip through floating-point.
+     * Fractional digits beyond `Scale` are an error, unless they're zeroes.
+     *
+     * \code{.cpp}
+     * scn::fixed_point<int64_t, 4> price{};
+     * auto result = scn::scan("1234.5678", "{}", price);
+     * // price.value == 12345678
+     * \endcode
+     */
+    template <typename T, unsigned Scale>
+    struct fixed_point {
+        static_assert(static_cast<int>(Scale) <=
+                          detail::max_fixed_point_scale<T>(),
+                      "10^Scale doesn't fit in T");
+
+        static constexpr unsigned scale = Scale;
+
+        T value{};
+    };
+
+    namespace detail {
 
         template <typename T>
         template <typename CharT>
@@ -493,7 +578,9 @@ namespace scn {
             s.format_options = flags & 0xffu;
             s.common_options = static_cast<uint8_t>(flags >> 8u);
             SCN_CLANG_PUSH_IGNORE_UNDEFINED_TEMPLATE
-            auto n = s._parse_int(val, buf);
+            auto n = s._parse_int(val, buf,
+                                  (s.format_options & s.allow_thsep) != 0,
+                                  ascii_widen<CharT>(','));
             SCN_CLANG_POP_IGNORE_UNDEFINED_TEMPLATE
             if (!n) {
                 return n.error();
@@ -523,7 +610,9 @@ namespace scn {
             }
 
             SCN_CLANG_PUSH_IGNORE_UNDEFINED_TEMPLATE
-            return s._parse_int_impl(val, minus_sign, buf);
+            return s._parse_int_impl(val, minus_sign, buf,
+                                     (s.format_options & s.allow_thsep) != 0,
+                                     ascii_widen<CharT>(','));
             SCN_CLANG_POP_IGNORE_UNDEFINED_TEMPLATE
         }
     }  // namespace detail
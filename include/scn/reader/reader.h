@@ -76,6 +76,27 @@ namespace scn {
     struct scanner<unsigned long long>
         : public detail::integer_scanner<unsigned long long> {
     };
+#if SCN_HAS_INT128
+    template <>
+    struct scanner<detail::int128>
+        : public detail::integer_scanner<detail::int128> {
+    };
+    template <>
+    struct scanner<detail::uint128>
+        : public detail::integer_scanner<detail::uint128> {
+    };
+#endif
+    template <typename T, unsigned Scale>
+    struct scanner<fixed_point<T, Scale>>
+        : public detail::fixed_point_scanner<T> {
+        scanner() : detail::fixed_point_scanner<T>(Scale) {}
+
+        template <typename Context>
+        error scan(fixed_point<T, Scale>& val, Context& ctx)
+        {
+            return detail::fixed_point_scanner<T>::scan(val.value, ctx);
+        }
+    };
     template <>
     struct scanner<float> : public detail::float_scanner<float> {
     };
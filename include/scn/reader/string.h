@@ -21,6 +21,9 @@
 #include "../util/small_vector.h"
 #include "common.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace scn {
     SCN_BEGIN_NAMESPACE
     namespace detail {
@@ -285,6 +288,7 @@ namespace scn {
                     }
                 }
 
+                compile();
                 return {};
             }
 
@@ -353,20 +357,77 @@ namespace scn {
                     }
                     SCN_CLANG_POP_IGNORE_UNDEFINED_TEMPLATE
                 }
-                if (get_option(flag::use_chars) && (ch >= 0 && ch <= 0x7f)) {
-                    if (get_option(static_cast<char>(ch))) {
-                        return not_inverted;
-                    }
+                if (contains(static_cast<uint32_t>(ch))) {
+                    return not_inverted;
                 }
-                if (get_option(flag::use_ranges)) {
-                    const auto c = static_cast<uint32_t>(ch);
-                    for (const auto& e : set_extra_ranges) {
-                        if (c >= e.begin && c <= e.end) {
-                            return not_inverted;
+                return !not_inverted;
+            }
+
+            // Returns the first code unit in [it, end) not accepted by the
+            // set. Doesn't consider localized specifiers: only usable if
+            // use_specifiers = false. Multibyte sets (use_ranges = true with
+            // char) need to be decoded first, and can't be checked with this.
+            const char* find_first_rejected(const char* it,
+                                            const char* end) const
+            {
+                SCN_EXPECT(get_option(flag::enabled));
+                SCN_EXPECT(!get_option(flag::use_specifiers));
+                SCN_EXPECT(!get_option(flag::use_ranges));
+
+                const bool inverted = get_option(flag::inverted);
+                if (get_option(flag::accept_all)) {
+                    return inverted ? it : end;
+                }
+
+                // Bit set = code unit not accepted
+                const uint64_t flip = inverted ? 0 : ~uint64_t{0};
+                const uint64_t rejected[4] = {
+                    set_bitmap[0] ^ flip, set_bitmap[1] ^ flip,
+                    set_bitmap[2] ^ flip, set_bitmap[3] ^ flip};
+                auto is_rejected = [&rejected](char ch) -> unsigned {
+                    const auto c = static_cast<unsigned char>(ch);
+                    return static_cast<unsigned>(
+                        (rejected[c >> 6] >> (c & 63)) & 1);
+                };
+
+                // Look up eight code units at a time, and only branch once
+                // per block
+                for (; end - it >= 8; it += 8) {
+                    unsigned mask =
+                        is_rejected(it[0]) | (is_rejected(it[1]) << 1) |
+                        (is_rejected(it[2]) << 2) | (is_rejected(it[3]) << 3) |
+                        (is_rejected(it[4]) << 4) | (is_rejected(it[5]) << 5) |
+                        (is_rejected(it[6]) << 6) | (is_rejected(it[7]) << 7);
+                    if (mask != 0) {
+                        for (; (mask & 1) == 0; mask >>= 1) {
+                            ++it;
                         }
+                        return it;
                     }
                 }
-                return !not_inverted;
+                for (; it != end; ++it) {
+                    if (is_rejected(*it) != 0) {
+                        break;
+                    }
+                }
+                return it;
+            }
+            const wchar_t* find_first_rejected(const wchar_t* it,
+                                               const wchar_t* end)
+            {
+                SCN_EXPECT(get_option(flag::enabled));
+                SCN_EXPECT(!get_option(flag::use_specifiers));
+
+                const bool inverted = get_option(flag::inverted);
+                if (get_option(flag::accept_all)) {
+                    return inverted ? it : end;
+                }
+                for (; it != end; ++it) {
+                    if (contains(static_cast<uint32_t>(*it)) == inverted) {
+                        break;
+                    }
+                }
+                return it;
             }
 
             enum class specifier : size_t {
@@ -446,6 +507,184 @@ namespace scn {
             }
 
         private:
+            // Builds the lookup tables used by check_character(),
+            // after the set has been parsed and sanitized
+            void compile()
+            {
+                // Sort set_extra_ranges, and merge overlapping and adjacent
+                // ranges, to make them binary searchable
+                if (set_extra_ranges.size() > 1) {
+                    std::sort(set_extra_ranges.begin(), set_extra_ranges.end(),
+                              [](const set_range& a, const set_range& b) {
+                                  return a.begin < b.begin;
+                              });
+                    auto out = set_extra_ranges.begin();
+                    for (auto it = out + 1; it != set_extra_ranges.end();
+                         ++it) {
+                        if (out->end != 0xffffffff &&
+                            it->begin > out->end + 1) {
+                            *++out = *it;
+                        }
+                        else if (it->end > out->end) {
+                            out->end = it->end;
+                        }
+                    }
+                    set_extra_ranges.erase(out + 1, set_extra_ranges.end());
+                }
+
+                // Bitmap of accepted code points 0x00 - 0xff
+                set_bitmap = {{0}};
+                if (get_option(flag::use_chars)) {
+                    // Pack the bools in set_options[0x00 - 0x7f],
+                    // eight at a time
+                    for (size_t i = 0; i < 16; ++i) {
+                        uint64_t bits{};
+#if SCN_IS_BIG_ENDIAN
+                        for (size_t j = 0; j < 8; ++j) {
+                            bits |= uint64_t{set_options[i * 8 + j]} << j;
+                        }
+#else
+                        static_assert(sizeof(bool) == 1, "");
+                        uint64_t bytes{};
+                        std::memcpy(&bytes, set_options.data() + i * 8, 8);
+                        // Moves the low bit of byte j to bit 56 + j
+                        bits = (bytes * uint64_t{0x0102040810204080}) >> 56;
+#endif
+                        set_bitmap[i / 8] |= bits << ((i % 8) * 8);
+                    }
+                }
+                for (const auto& e : set_extra_ranges) {
+                    if (e.begin > 0xff) {
+                        break;
+                    }
+                    set_block_bits(set_bitmap.data(), e.begin,
+                                   min(e.end, uint32_t{0xff}));
+                }
+
+                set_range_index.clear();
+                set_range_blocks.clear();
+                set_range_lookups =
+                    set_extra_ranges.size() >= range_table_threshold
+                        ? range_table_lookups
+                        : 0;
+            }
+
+            // With this many ranges or more (after merging),
+            // a two-stage lookup table is built for them,
+            // instead of binary searching set_extra_ranges
+            static constexpr size_t range_table_threshold = 8;
+            // The set is parsed again on every scan, so the table is only
+            // built after this many binary searches: short tokens never
+            // pay for it
+            static constexpr uint32_t range_table_lookups = 64;
+            // Highest code point covered by the table
+            static constexpr uint32_t range_table_max = 0x10ffff;
+
+            // Two-stage table: set_range_index has an entry for every block
+            // of 256 code points, up to the last code point in
+            // set_extra_ranges. The entry is the index of a 256-bit block in
+            // set_range_blocks. Block 0 is empty, block 1 is full, and the
+            // rest are blocks partially covered by ranges.
+            void compile_range_table()
+            {
+                // Each range can create at most two partial blocks
+                if (2 + set_extra_ranges.size() * 2 > 0xffff) {
+                    return;
+                }
+
+                const auto last =
+                    min(set_extra_ranges.back().end, range_table_max);
+                set_range_index.resize(static_cast<size_t>(last >> 8) + 1);
+                set_range_blocks.reserve(8 + set_extra_ranges.size() * 8);
+                set_range_blocks.resize(8);
+                std::fill(set_range_blocks.begin() + 4,
+                          set_range_blocks.end(), ~uint64_t{0});
+
+                const auto index = set_range_index.data();
+                auto mark_partial = [&](uint32_t b, uint32_t first,
+                                        uint32_t last_in_block) {
+                    // Ranges are merged, so a partial block is never
+                    // already full
+                    if (index[b] == 0) {
+                        index[b] = static_cast<uint16_t>(
+                            set_range_blocks.size() / 4);
+                        set_range_blocks.resize(set_range_blocks.size() + 4);
+                    }
+                    set_block_bits(set_range_blocks.data() + index[b] * 4,
+                                   first, last_in_block);
+                };
+                for (const auto& e : set_extra_ranges) {
+                    if (e.begin > last) {
+                        break;
+                    }
+                    const auto end = min(e.end, last);
+                    const auto first_block = e.begin >> 8;
+                    const auto last_block = end >> 8;
+
+                    // Blocks entirely covered by the range: [full, full_end)
+                    const auto full = (e.begin & 0xff) == 0 ? first_block
+                                                            : first_block + 1;
+                    const auto full_end =
+                        (end & 0xff) == 0xff ? last_block + 1 : last_block;
+                    if (full < full_end) {
+                        std::fill(index + full, index + full_end,
+                                  uint16_t{1});
+                    }
+
+                    if (first_block == last_block) {
+                        if (full_end <= full) {
+                            mark_partial(first_block, e.begin & 0xff,
+                                         end & 0xff);
+                        }
+                        continue;
+                    }
+                    if (full != first_block) {
+                        mark_partial(first_block, e.begin & 0xff, 0xff);
+                    }
+                    if (full_end == last_block) {
+                        mark_partial(last_block, 0, end & 0xff);
+                    }
+                }
+            }
+
+            // Sets bits [first, last] in a 256-bit block
+            static void set_block_bits(uint64_t* block,
+                                       uint32_t first,
+                                       uint32_t last)
+            {
+                SCN_EXPECT(first <= last && last <= 0xff);
+                for (auto w = first >> 6; w <= (last >> 6); ++w) {
+                    const auto lo = w == (first >> 6) ? (first & 63) : 0;
+                    const auto hi = w == (last >> 6) ? (last & 63) : 63;
+                    block[w] |= (~uint64_t{0} >> (63 - (hi - lo))) << lo;
+                }
+            }
+
+            // true = code point in set (doesn't take specifiers, or
+            // accept_all or inverted flags into account)
+            SCN_NODISCARD bool contains(uint32_t c)
+            {
+                if (c <= 0xff) {
+                    return ((set_bitmap[c >> 6] >> (c & 63)) & 1) != 0;
+                }
+                if (!get_option(flag::use_ranges)) {
+                    return false;
+                }
+                if (set_range_lookups != 0 && --set_range_lookups == 0) {
+                    compile_range_table();
+                }
+                if ((c >> 8) < set_range_index.size()) {
+                    const auto block =
+                        set_range_blocks.data() + set_range_index[c >> 8] * 4;
+                    return ((block[(c >> 6) & 3] >> (c & 63)) & 1) != 0;
+                }
+                // Last range beginning at or before c
+                auto it = std::upper_bound(
+                    set_extra_ranges.begin(), set_extra_ranges.end(), c,
+                    [](uint32_t v, const set_range& e) { return v < e.begin; });
+                return it != set_extra_ranges.begin() && c <= (it - 1)->end;
+            }
+
             void accept_char(char ch)
             {
                 get_option(ch) = true;
@@ -1035,7 +1274,17 @@ namespace scn {
                 }
             };
             // Used if set_options[use_ranges] = true
+            // Sorted and merged by compile()
             small_vector<set_range, 1> set_extra_ranges{};
+            // Accepted code points 0x00 - 0xff, built by compile() from
+            // set_options[0x00 - 0x7f] and set_extra_ranges
+            array<uint64_t, 4> set_bitmap{{0}};
+            // Lookup table for set_extra_ranges, see compile_range_table()
+            small_vector<uint16_t, 1> set_range_index{};
+            small_vector<uint64_t, 1> set_range_blocks{};
+            // Binary searches left before the lookup table is built,
+            // 0 = never
+            uint32_t set_range_lookups{0};
         };
 
         struct string_scanner : common_parser {
@@ -1182,6 +1431,36 @@ namespace scn {
                 {
                     return multibyte;
                 }
+
+                // Found by read_until_space_zero_copy through ADL
+                template <typename WrappedRange>
+                friend expected<span<const typename WrappedRange::char_type>>
+                read_until_space_contiguous(WrappedRange& r,
+                                            pred& p,
+                                            bool keep_final_space)
+                {
+                    using char_type = typename WrappedRange::char_type;
+                    if (p.multibyte ||
+                        p.set_parser.get_option(
+                            set_parser_type::flag::use_specifiers)) {
+                        return detail::read_until_pred_contiguous(
+                            r, p, true, keep_final_space);
+                    }
+
+                    // Code units can be checked against the set bitmap
+                    // directly, without decoding or calling the predicate
+                    if (r.begin() == r.end()) {
+                        return error(error::end_of_range, "EOF");
+                    }
+                    const auto begin = r.data();
+                    const auto end = begin + r.size();
+                    auto it = p.set_parser.find_first_rejected(begin, end);
+                    if (keep_final_space && it != end) {
+                        ++it;
+                    }
+                    r.advance_to(r.begin() + (it - begin));
+                    return span<const char_type>{begin, it};
+                }
             };
         };
 
@@ -444,6 +444,190 @@ namespace scn {
     }
 #endif
 
+    namespace detail {
+        template <typename CharT, typename Container>
+        error scan_integers_impl(const CharT*& it,
+                                 const CharT* end,
+                                 Container& c,
+                                 optional<CharT> separator)
+        {
+            using value_type = typename Container::value_type;
+            static_assert(is_integer<value_type>::value,
+                          "scan_integers requires a container of integers");
+
+            auto s = simple_integer_scanner<value_type>{};
+
+            it = find_first_non_space(it, end);
+            while (it != end && c.size() != c.max_size()) {
+                value_type value{};
+                SCN_CLANG_PUSH_IGNORE_UNDEFINED_TEMPLATE
+                auto ret = s.scan(span<const CharT>{it, end}, value, 10);
+                SCN_CLANG_POP_IGNORE_UNDEFINED_TEMPLATE
+                if (!ret) {
+                    if (ret.error() == error::invalid_scanned_value) {
+                        // not an integer: stop here, without an error
+                        return {};
+                    }
+                    return ret.error();
+                }
+                c.push_back(value);
+
+                it = find_first_non_space(ret.value(), end);
+                if (separator && it != end && *it == separator.get()) {
+                    it = find_first_non_space(it + 1, end);
+                }
+            }
+            return {};
+        }
+
+        template <typename Range, typename Container, typename CharT>
+        auto scan_integers_for_range(Range&& r,
+                                     Container& c,
+                                     optional<CharT> separator)
+            -> generic_scan_result_for_range<expected<std::size_t>, Range>
+        {
+            auto range = wrap(SCN_FWD(r));
+            static_assert(decltype(range)::is_contiguous,
+                          "scan_integers requires a contiguous range");
+
+            const auto begin = range.data();
+            auto it = begin;
+            const auto size_before = c.size();
+            auto err = scan_integers_impl(
+                it, begin + range.size(), c, SCN_MOVE(separator));
+            range.advance(it - begin);
+
+            if (!err) {
+                return wrap_result(expected<std::size_t>{err},
+                                   range_tag<Range>{}, SCN_MOVE(range));
+            }
+            return wrap_result(expected<std::size_t>{c.size() - size_before},
+                               range_tag<Range>{}, SCN_MOVE(range));
+        }
+    }  // namespace detail
+
+    /**
+     * Reads base-10 integers from the contiguous range `r` into `c`, until
+     * a character that doesn't begin an integer is found, the range is
+     * exhausted, or `c.max_size()` is reached.
+     *
+     * The integers are separated by whitespace, and optionally by a single
+     * `separator`, which may be surrounded by whitespace.
+     *
+     * Unlike `scan_list()`, doesn't go through the format string and argument
+     * machinery for every value: the input is walked in a single loop, and
+     * the digits are handed directly to the integer parser.
+     * This makes it well-suited for reading large columns of numbers.
+     *
+     * The value of the returned result is the number of integers read.
+     * Its range begins where the next integer would have started: after the
+     * last integer, and the whitespace and separator following it.
+     * Running into something that is not an integer is not an error.
+     * If an integer doesn't fit into `Container::value_type`,
+     * `error::value_out_of_range` is returned, and the range begins at that
+     * integer.
+     *
+     * \code{.cpp}
+     * std::vector<int> vec{};
+     * auto result = scn::scan_integers("1, 2, 3 4 abc", vec, ',');
+     * // vec == [1, 2, 3, 4]
+     * // result.value() == 4
+     * // result.range() == "abc"
+     * \endcode
+     *
+     * \param r Contiguous range to read from
+     * \param c Container to write values to, using `c.push_back()`.
+     */
+#if SCN_DOXYGEN
+    template <typename Range, typename Container, typename CharT>
+    auto scan_integers(Range&& r, Container& c, CharT separator)
+        -> detail::generic_scan_result_for_range<expected<std::size_t>, Range>;
+#else
+    template <typename Range,
+              typename Container,
+              typename CharT = typename range_wrapper_for_t<
+                  Range>::char_type>
+    SCN_NODISCARD auto scan_integers(Range&& r,
+                                     Container& c,
+                                     CharT separator)
+        -> detail::generic_scan_result_for_range<expected<std::size_t>, Range>
+    {
+        return detail::scan_integers_for_range(SCN_FWD(r), c,
+                                               optional<CharT>{separator});
+    }
+#endif
+
+    /**
+     * Equivalent to `scan_integers(r, c, separator)`, except the integers
+     * are separated by whitespace only.
+     */
+#if SCN_DOXYGEN
+    template <typename Range, typename Container>
+    auto scan_integers(Range&& r, Container& c)
+        -> detail::generic_scan_result_for_range<expected<std::size_t>, Range>;
+#else
+    template <typename Range, typename Container>
+    SCN_NODISCARD auto scan_integers(Range&& r, Container& c)
+        -> detail::generic_scan_result_for_range<expected<std::size_t>, Range>
+    {
+        using char_type =
+            typename range_wrapper_for_t<Range>::char_type;
+        return detail::scan_integers_for_range(SCN_FWD(r), c,
+                                               optional<char_type>{});
+    }
+#endif
+
+    /**
+     * Equivalent to `scan_integers(r, c, separator)`, except the integers
+     * are written into `s`, and at most `s.size()` of them are read.
+     *
+     * \code{.cpp}
+     * std::vector<int> buffer(4, 0);
+     * auto result = scn::scan_integers("1 2 3 4 5", scn::make_span(buffer));
+     * // buffer == [1, 2, 3, 4]
+     * // result.value() == 4
+     * // result.range() == "5"
+     * \endcode
+     */
+#if SCN_DOXYGEN
+    template <typename Range, typename T, typename CharT>
+    auto scan_integers(Range&& r, span<T> s, CharT separator)
+        -> detail::generic_scan_result_for_range<expected<std::size_t>, Range>;
+#else
+    template <typename Range,
+              typename T,
+              typename CharT = typename range_wrapper_for_t<
+                  Range>::char_type>
+    SCN_NODISCARD auto scan_integers(Range&& r, span<T> s, CharT separator)
+        -> detail::generic_scan_result_for_range<expected<std::size_t>, Range>
+    {
+        auto wrapper = span_list_wrapper<T>(s);
+        return detail::scan_integers_for_range(SCN_FWD(r), wrapper,
+                                               optional<CharT>{separator});
+    }
+#endif
+
+    /**
+     * Equivalent to `scan_integers(r, s, separator)`, except the integers
+     * are separated by whitespace only.
+     */
+#if SCN_DOXYGEN
+    template <typename Range, typename T>
+    auto scan_integers(Range&& r, span<T> s)
+        -> detail::generic_scan_result_for_range<expected<std::size_t>, Range>;
+#else
+    template <typename Range, typename T>
+    SCN_NODISCARD auto scan_integers(Range&& r, span<T> s)
+        -> detail::generic_scan_result_for_range<expected<std::size_t>, Range>
+    {
+        using char_type =
+            typename range_wrapper_for_t<Range>::char_type;
+        auto wrapper = span_list_wrapper<T>(s);
+        return detail::scan_integers_for_range(SCN_FWD(r), wrapper,
+                                               optional<char_type>{});
+    }
+#endif
+
     SCN_END_NAMESPACE
 }  // namespace scn
 
@@ -0,0 +1,236 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#ifndef SCN_SCAN_PARALLEL_H
+#define SCN_SCAN_PARALLEL_H
+
+#include "common.h"
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace scn {
+    SCN_BEGIN_NAMESPACE
+
+    /**
+     * Splits `source` into at most `num_chunks` chunks of roughly equal
+     * size, so that every chunk, except possibly the last one, ends right
+     * after a `delimiter`. A record ending in `delimiter` is never split
+     * between two chunks.
+     *
+     * Doesn't copy: the returned chunks point into `source`.
+     * Empty chunks are not returned.
+     *
+     * \code{.cpp}
+     * auto chunks = scn::split_chunks(scn::make_span("1\n2\n3\n4\n", 8), '\n', 2);
+     * // chunks[0] == "1\n2\n"
+     * // chunks[1] == "3\n4\n"
+     * \endcode
+     */
+    template <typename CharT>
+    std::vector<span<const CharT>> split_chunks(span<const CharT> source,
+                                                CharT delimiter,
+                                                std::size_t num_chunks)
+    {
+        SCN_EXPECT(num_chunks > 0);
+
+        std::vector<span<const CharT>> chunks;
+        chunks.reserve(num_chunks);
+
+        auto chunk_begin = source.begin();
+        for (std::size_t i = 1; i < num_chunks; ++i) {
+            const auto target =
+                source.begin() +
+                static_cast<std::ptrdiff_t>(source.size() * i / num_chunks);
+            if (target <= chunk_begin) {
+                continue;
+            }
+            auto delim = std::find(target - 1, source.end(), delimiter);
+            if (delim == source.end()) {
+                break;
+            }
+            chunks.push_back(span<const CharT>{chunk_begin, delim + 1});
+            chunk_begin = delim + 1;
+        }
+        if (chunk_begin != source.end()) {
+            chunks.push_back(span<const CharT>{chunk_begin, source.end()});
+        }
+        return chunks;
+    }
+
+    namespace detail {
+        // Joins every thread in it when destroyed, so that no thread
+        // outlives the state it uses, even if starting another one throws
+        struct joining_threads {
+            joining_threads() = default;
+            joining_threads(const joining_threads&) = delete;
+            joining_threads& operator=(const joining_threads&) = delete;
+
+            ~joining_threads()
+            {
+                for (auto& t : threads) {
+                    if (t.joinable()) {
+                        t.join();
+                    }
+                }
+            }
+
+            std::vector<std::thread> threads;
+        };
+    }  // namespace detail
+
+    /**
+     * Splits `source` into chunks with `split_chunks`, and calls `fn` on
+     * every chunk (a `span<const CharT>`), in parallel.
+     *
+     * The chunks are processed by at most
+     * `std::thread::hardware_concurrency()` threads, including the calling
+     * one. Every thread picks the next unprocessed chunk when it's done
+     * with the previous one, so splitting into more chunks than there are
+     * threads evens out the load when the chunks take different amounts of
+     * time.
+     *
+     * `fn` is called concurrently, so it must not modify shared state
+     * without synchronization. Every thread calls its own copy of `fn`.
+     * Typically, it scans every record in its chunk into a local container,
+     * and returns it.
+     *
+     * \param num_chunks Maximum number of chunks to split `source` into.
+     * If `0`, uses `std::thread::hardware_concurrency()`.
+     *
+     * \return A `std::vector` of the values returned by `fn`, in the same
+     * order as the chunks are in `source`.
+     * If `fn` throws, the exception is rethrown after every call to `fn` has
+     * finished.
+     * If copying `fn` or starting a thread throws, the exception is
+     * rethrown after the threads already started have finished.
+     *
+     * \code{.cpp}
+     * auto file = scn::mapped_file{"records.txt"};
+     * auto sums = scn::scan_chunks(file.buffer(), '\n', 0,
+     *     [](scn::span<const char> chunk) {
+     *         long long sum = 0;
+     *         auto result = scn::make_result(chunk);
+     *         int i;
+     *         while ((result = scn::scan(result.range(), "{}", i))) {
+     *             sum += i;
+     *         }
+     *         return sum;
+     *     });
+     * \endcode
+     */
+    template <typename CharT, typename Function>
+    auto scan_chunks(span<const CharT> source,
+                     CharT delimiter,
+                     std::size_t num_chunks,
+                     Function fn)
+        -> std::vector<decltype(fn(span<const CharT>{}))>
+    {
+        using result_type = decltype(fn(span<const CharT>{}));
+
+        const auto hardware_threads =
+            detail::max(std::size_t{std::thread::hardware_concurrency()},
+                        std::size_t{1});
+        if (num_chunks == 0) {
+            num_chunks = hardware_threads;
+        }
+        const auto chunks = split_chunks(source, delimiter, num_chunks);
+
+        std::vector<result_type> results;
+        results.reserve(chunks.size());
+        if (chunks.empty()) {
+            return results;
+        }
+
+        // A packaged_task stores either the result or the exception,
+        // to be retrieved in chunk order once every task has finished
+        using task_type =
+            std::packaged_task<result_type(Function&, span<const CharT>)>;
+        std::vector<task_type> tasks;
+        std::vector<std::future<result_type>> futures;
+        tasks.reserve(chunks.size());
+        futures.reserve(chunks.size());
+        for (std::size_t i = 0; i < chunks.size(); ++i) {
+            tasks.emplace_back([](Function& f, span<const CharT> chunk) {
+                return f(chunk);
+            });
+            futures.push_back(tasks.back().get_future());
+        }
+
+        std::atomic<std::size_t> next_chunk{0};
+        auto work = [&](Function& f) {
+            for (auto i = next_chunk.fetch_add(1); i < tasks.size();
+                 i = next_chunk.fetch_add(1)) {
+                tasks[i](f, chunks[i]);
+            }
+        };
+
+        // The calling thread is one of the workers.
+        // If starting a thread or copying `fn` throws, the threads already
+        // started finish every chunk, and are joined before the exception
+        // propagates.
+        {
+            const auto num_threads =
+                detail::min(hardware_threads, chunks.size());
+            detail::joining_threads workers;
+            workers.threads.reserve(num_threads - 1);
+            for (std::size_t i = 1; i < num_threads; ++i) {
+                workers.threads.emplace_back(
+                    [&work, fn]() mutable { work(fn); });
+            }
+            work(fn);
+        }
+
+        for (auto& f : futures) {
+            results.push_back(f.get());
+        }
+        return results;
+    }
+
+    /**
+     * Splits a contiguous source range into chunks, and calls `fn` on every
+     * chunk in parallel.
+     *
+     * \see scan_chunks(span<const CharT>, CharT, std::size_t, Function)
+     */
+    template <typename Range,
+              typename Function,
+              typename CharT = typename range_wrapper_for_t<
+                  const Range&>::char_type>
+    auto scan_chunks(const Range& r,
+                     CharT delimiter,
+                     std::size_t num_chunks,
+                     Function fn)
+        -> std::vector<decltype(fn(span<const CharT>{}))>
+    {
+        auto wrapped = wrap(r);
+        static_assert(decltype(wrapped)::is_contiguous,
+                      "scan_chunks requires a contiguous range");
+        return scan_chunks(
+            span<const CharT>{wrapped.data(),
+                              static_cast<std::size_t>(wrapped.size())},
+            delimiter,
+            num_chunks, SCN_MOVE(fn));
+    }
+
+    SCN_END_NAMESPACE
+}  // namespace scn
+
+#endif  // SCN_SCAN_PARALLEL_H
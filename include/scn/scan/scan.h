@@ -278,7 +278,7 @@ namespace scn {
     {
         auto& range = stdin_range<CharT>();
         auto ret = detail::scan_boilerplate(range, f, a...);
-        range.sync();
+        range.sync(ret.range().begin());
         ret.range().reset_begin_iterator();
         return ret;
     }
@@ -126,7 +126,7 @@ namespace scn {
                                                       code_point cp,
                                                       utf32_tag)
         {
-            SCN_EXPECT(begin + 1 >= end);
+            SCN_EXPECT(begin + 1 <= end);
             *begin++ = static_cast<uint32_t>(cp);
             return {begin};
         }
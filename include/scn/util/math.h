@@ -73,6 +73,20 @@ namespace scn {
             return d;
         }
 
+        /**
+         * Returns the largest number of digits `d` in base `base`, for which
+         * every `d`-digit number is guaranteed to be `<= max`.
+         */
+        template <typename T>
+        constexpr int safe_digits(T max, T base) noexcept
+        {
+            return max < base - 1
+                       ? 0
+                       : 1 + safe_digits<T>(
+                                 static_cast<T>((max - (base - 1)) / base),
+                                 base);
+        }
+
         /**
          * Implementation of `std::div`, which is constexpr pre-C++23
          */
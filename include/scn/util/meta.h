@@ -67,6 +67,36 @@ namespace scn {
         template <typename T>
         using integer_type_for_char = typename std::
             conditional<std::is_signed<T>::value, int, unsigned>::type;
+
+#if SCN_HAS_INT128
+        __extension__ typedef __int128 int128;
+        __extension__ typedef unsigned __int128 uint128;
+#endif
+
+        // std::is_integral, std::is_signed, and std::make_unsigned,
+        // that also work with 128-bit integers in strict ISO mode
+        template <typename T>
+        struct is_integer : std::is_integral<T> {};
+        template <typename T>
+        struct is_signed_integer : std::is_signed<T> {};
+        template <typename T>
+        struct make_unsigned_integer : std::make_unsigned<T> {};
+#if SCN_HAS_INT128
+        template <>
+        struct is_integer<int128> : std::true_type {};
+        template <>
+        struct is_integer<uint128> : std::true_type {};
+        template <>
+        struct is_signed_integer<int128> : std::true_type {};
+        template <>
+        struct make_unsigned_integer<int128> {
+            using type = uint128;
+        };
+        template <>
+        struct make_unsigned_integer<uint128> {
+            using type = uint128;
+        };
+#endif
     }  // namespace detail
 
     SCN_END_NAMESPACE
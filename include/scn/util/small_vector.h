@@ -651,7 +651,7 @@ namespace scn {
             {
                 if (count > size()) {
                     if (count > capacity()) {
-                        _realloc(next_pow2(capacity()));
+                        _realloc(next_pow2(count));
                     }
                     uninitialized_fill_value_init(begin() + size(),
                                                   begin() + count);
@@ -26,6 +26,8 @@
 #include <cstdio>
 
 #if SCN_POSIX
+#include <cerrno>
+#include <climits>
 #include <fcntl.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
@@ -73,7 +75,86 @@ namespace scn {
 #endif
         }
 
-        SCN_FUNC byte_mapped_file::byte_mapped_file(const char* filename)
+        SCN_FUNC expected<size_t> read_native_file(native_file_handle h,
+                                                   void* buf,
+                                                   size_t n)
+        {
+#if SCN_POSIX
+            n = min(n, static_cast<size_t>(SSIZE_MAX));
+            while (true) {
+                auto ret = ::read(h.handle, buf, n);
+                if (ret >= 0) {
+                    return static_cast<size_t>(ret);
+                }
+                if (errno != EINTR) {
+                    return error(error::source_error, "read error");
+                }
+            }
+#elif SCN_WINDOWS
+            DWORD ret{0};
+            if (::ReadFile(h.handle, buf,
+                           static_cast<DWORD>(min(n, size_t{0xffffffff})),
+                           &ret, nullptr) == 0) {
+                if (::GetLastError() == ERROR_BROKEN_PIPE) {
+                    // Write end of a pipe closed: EOF
+                    return size_t{0};
+                }
+                return error(error::source_error, "ReadFile error");
+            }
+            return static_cast<size_t>(ret);
+#else
+            SCN_UNUSED(h);
+            SCN_UNUSED(buf);
+            SCN_UNUSED(n);
+            return error(error::unrecoverable_source_error,
+                         "Reading from a native file handle is not supported "
+                         "on this platform");
+#endif
+        }
+
+#if SCN_POSIX
+        namespace {
+            // Maps `size` bytes of `fd` at an address aligned to `alignment`
+            void* mmap_aligned(size_t size, int flags, int fd, size_t alignment)
+            {
+                // Reserve enough address space to find an aligned address in
+                int reserve_flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_NORESERVE
+                reserve_flags |= MAP_NORESERVE;
+#endif
+                auto reserved = mmap(nullptr, size + alignment, PROT_NONE,
+                                     reserve_flags, -1, 0);
+                if (reserved == MAP_FAILED) {
+                    return MAP_FAILED;
+                }
+                const auto addr = reinterpret_cast<uintptr_t>(reserved);
+                const auto aligned =
+                    (addr + alignment - 1) / alignment * alignment;
+                const auto head = aligned - addr;
+
+                auto ptr = mmap(reinterpret_cast<void*>(aligned), size,
+                                PROT_READ, flags | MAP_FIXED, fd, 0);
+                if (ptr == MAP_FAILED) {
+                    munmap(reserved, size + alignment);
+                    return MAP_FAILED;
+                }
+                // Give back the rest of the reservation
+                if (head != 0) {
+                    munmap(reserved, head);
+                }
+                const auto page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+                const auto end = (aligned + size + page - 1) / page * page;
+                const auto tail = addr + size + alignment - end;
+                if (tail != 0) {
+                    munmap(reinterpret_cast<void*>(end), tail);
+                }
+                return ptr;
+            }
+        }  // namespace
+#endif
+
+        SCN_FUNC byte_mapped_file::byte_mapped_file(const char* filename,
+                                                    unsigned hints)
         {
 #if SCN_POSIX
             int fd = open(filename, O_RDONLY);
@@ -88,19 +169,48 @@ namespace scn {
                 close(fd);
                 return;
             }
-            auto size = s.st_size;
+            auto size = static_cast<size_t>(s.st_size);
+
+            int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+            if ((hints & map_populate) != 0) {
+                flags |= MAP_POPULATE;
+            }
+#endif
 
-            auto ptr =
-                static_cast<char*>(mmap(nullptr, static_cast<size_t>(size),
-                                        PROT_READ, MAP_PRIVATE, fd, 0));
+            void* ptr = MAP_FAILED;
+            if ((hints & map_huge_pages) != 0 && size != 0) {
+                // 2 MiB is the huge page size on x86-64 and AArch64 (with 4K
+                // pages)
+                ptr = mmap_aligned(size, flags, fd, size_t{2} << 20u);
+            }
+            if (ptr == MAP_FAILED) {
+                ptr = mmap(nullptr, size, PROT_READ, flags, fd, 0);
+            }
             if (ptr == MAP_FAILED) {
                 close(fd);
                 return;
             }
 
+#ifdef MADV_HUGEPAGE
+            if ((hints & map_huge_pages) != 0) {
+                madvise(ptr, size, MADV_HUGEPAGE);
+            }
+#endif
+            if ((hints & map_sequential) != 0) {
+                posix_madvise(ptr, size, POSIX_MADV_SEQUENTIAL);
+            }
+#ifndef MAP_POPULATE
+            if ((hints & map_populate) != 0) {
+                posix_madvise(ptr, size, POSIX_MADV_WILLNEED);
+            }
+#endif
+
             m_file.handle = fd;
-            m_map = span<char>{ptr, static_cast<size_t>(size)};
+            m_map = span<char>{static_cast<char*>(ptr), size};
 #elif SCN_WINDOWS
+            SCN_UNUSED(hints);
+
             auto f = ::CreateFileA(
                 filename, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
                 nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
@@ -140,6 +250,23 @@ namespace scn {
             m_map = span<char>{static_cast<char*>(start), size};
 #else
             SCN_UNUSED(filename);
+            SCN_UNUSED(hints);
+#endif
+        }
+
+        SCN_FUNC void byte_mapped_file::_release_until(size_t n)
+        {
+#if SCN_POSIX
+            const auto page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+            // Only whole pages before n
+            n = n / page * page;
+            if (n <= m_released) {
+                return;
+            }
+            madvise(m_map.data() + m_released, n - m_released, MADV_DONTNEED);
+            m_released = n;
+#else
+            SCN_UNUSED(n);
 #endif
         }
 
@@ -156,6 +283,144 @@ namespace scn {
 
             m_file = native_file_handle::invalid();
             m_map = span<char>{};
+            m_released = 0;
+
+            SCN_ENSURE(!valid());
+        }
+
+        SCN_FUNC byte_windowed_mapped_file::byte_windowed_mapped_file(
+            const char* filename,
+            size_t window_size)
+        {
+#if SCN_POSIX
+            const auto granularity =
+                static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+
+            int fd = open(filename, O_RDONLY);
+            if (fd == -1) {
+                return;
+            }
+
+            struct stat s {
+            };
+            int status = fstat(fd, &s);
+            if (status == -1) {
+                close(fd);
+                return;
+            }
+
+            m_file.handle = fd;
+            m_file_size = static_cast<size_t>(s.st_size);
+#elif SCN_WINDOWS
+            SYSTEM_INFO info;
+            ::GetSystemInfo(&info);
+            const auto granularity =
+                static_cast<size_t>(info.dwAllocationGranularity);
+
+            auto f = ::CreateFileA(
+                filename, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (f == INVALID_HANDLE_VALUE) {
+                return;
+            }
+
+            LARGE_INTEGER _size;
+            if (::GetFileSizeEx(f, &_size) == 0) {
+                ::CloseHandle(f);
+                return;
+            }
+            auto size = static_cast<size_t>(_size.QuadPart);
+
+            // Mapping an empty file fails
+            if (size != 0) {
+                auto h = ::CreateFileMappingA(f, nullptr, PAGE_READONLY, 0, 0,
+                                              nullptr);
+                if (h == INVALID_HANDLE_VALUE || h == nullptr) {
+                    ::CloseHandle(f);
+                    return;
+                }
+                m_map_handle.handle = h;
+            }
+
+            m_file.handle = f;
+            m_file_size = size;
+#else
+            const size_t granularity = 1;
+            SCN_UNUSED(filename);
+#endif
+            m_granularity = granularity;
+            m_window_size = max(
+                (window_size + granularity - 1) / granularity * granularity,
+                granularity);
+        }
+
+        SCN_FUNC error byte_windowed_mapped_file::_map_window(size_t offset,
+                                                              size_t n) const
+        {
+            SCN_EXPECT(valid());
+            SCN_EXPECT(offset + n <= m_file_size);
+
+            _unmap();
+
+            const auto begin = offset - offset % m_granularity;
+            const auto len =
+                min(max(m_window_size, offset + n - begin), m_file_size - begin);
+#if SCN_POSIX
+            auto ptr = ::mmap(nullptr, len, PROT_READ, MAP_PRIVATE,
+                              m_file.handle, static_cast<off_t>(begin));
+            if (ptr == MAP_FAILED) {
+                return {error::source_error, "mmap error"};
+            }
+#elif SCN_WINDOWS
+            const auto off = static_cast<unsigned long long>(begin);
+            auto ptr = ::MapViewOfFile(m_map_handle.handle, FILE_MAP_READ,
+                                       static_cast<DWORD>(off >> 32ull),
+                                       static_cast<DWORD>(off & 0xffffffffull),
+                                       len);
+            if (!ptr) {
+                return {error::source_error, "MapViewOfFile error"};
+            }
+#else
+            SCN_UNUSED(len);
+            return {error::unrecoverable_source_error,
+                    "Memory mapping not supported on this platform"};
+#endif
+#if SCN_POSIX || SCN_WINDOWS
+            m_map = span<char>{static_cast<char*>(ptr), len};
+            m_map_offset = begin;
+            return {};
+#endif
+        }
+
+        SCN_FUNC void byte_windowed_mapped_file::_unmap() const
+        {
+            if (m_map.size() == 0) {
+                return;
+            }
+#if SCN_POSIX
+            munmap(m_map.data(), m_map.size());
+#elif SCN_WINDOWS
+            ::UnmapViewOfFile(m_map.data());
+#endif
+            m_map = span<char>{};
+            m_map_offset = 0;
+        }
+
+        SCN_FUNC void byte_windowed_mapped_file::_destruct()
+        {
+            _unmap();
+#if SCN_POSIX
+            close(m_file.handle);
+#elif SCN_WINDOWS
+            if (m_map_handle.handle != native_file_handle::invalid().handle) {
+                ::CloseHandle(m_map_handle.handle);
+            }
+            ::CloseHandle(m_file.handle);
+            m_map_handle = native_file_handle::invalid();
+#endif
+
+            m_file = native_file_handle::invalid();
+            m_file_size = 0;
 
             SCN_ENSURE(!valid());
         }
@@ -175,7 +440,7 @@ namespace scn {
 
                 if (self.m_file->m_buffer.empty()) {
                     // no chars have been read
-                    return self.m_file->_read_single();
+                    return self.m_file->_read_next();
                 }
                 if (!self.m_last_error) {
                     // last read failed
@@ -191,7 +456,7 @@ namespace scn {
                         self.m_last_error.code() != error::end_of_range &&
                         !o.m_file) {
                         self.m_last_error = error{};
-                        auto r = self.m_file->_read_single();
+                        auto r = self.m_file->_read_next();
                         if (!r) {
                             self.m_last_error = r.error();
                             return !o.m_file || self.m_current == o.m_current ||
@@ -290,9 +555,70 @@ namespace scn {
         return ch;
     }
 
+    template <>
+    SCN_FUNC expected<char> file::_read_block() const
+    {
+        SCN_EXPECT(valid());
+        SCN_EXPECT(m_block_size > 1);
+
+        const auto old_size = m_buffer.size();
+        m_buffer.resize(old_size + m_block_size);
+        const auto n = std::fread(&m_buffer[old_size], 1, m_block_size, m_file);
+        m_buffer.resize(old_size + n);
+        if (n == 0) {
+            if (std::feof(m_file) != 0) {
+                return error(error::end_of_range, "EOF");
+            }
+            if (std::ferror(m_file) != 0) {
+                return error(error::source_error, "fread error");
+            }
+            return error(error::unrecoverable_source_error,
+                         "Unknown fread error");
+        }
+        return m_buffer[old_size];
+    }
+    template <>
+    SCN_FUNC expected<wchar_t> wfile::_read_block() const
+    {
+        SCN_EXPECT(valid());
+        SCN_EXPECT(m_block_size > 1);
+
+        // fread can't be used with wide-oriented streams
+        const auto old_size = m_buffer.size();
+        for (std::size_t i = 0; i < m_block_size; ++i) {
+            wint_t tmp = std::fgetwc(m_file);
+            if (tmp == WEOF) {
+                break;
+            }
+            m_buffer.push_back(static_cast<wchar_t>(tmp));
+        }
+        if (m_buffer.size() == old_size) {
+            if (std::feof(m_file) != 0) {
+                return error(error::end_of_range, "EOF");
+            }
+            if (std::ferror(m_file) != 0) {
+                return error(error::source_error, "fgetc error");
+            }
+            return error(error::unrecoverable_source_error,
+                         "Unknown fgetc error");
+        }
+        return m_buffer[old_size];
+    }
+
     template <>
     SCN_FUNC void file::_sync_until(std::size_t pos) noexcept
     {
+#if SCN_POSIX
+        // Seeking back is cheaper than putting back a whole block,
+        // and ungetc() only guarantees a single character of putback.
+        // If seeking fails, fall back to ungetc() anyway: see
+        // basic_file::set_block_size
+        const auto tail = m_buffer.size() - pos;
+        if (m_block_size > 1 && tail != 0 &&
+            std::fseek(m_file, -static_cast<long>(tail), SEEK_CUR) == 0) {
+            return;
+        }
+#endif
         for (auto it = m_buffer.rbegin();
              it != m_buffer.rend() - static_cast<std::ptrdiff_t>(pos); ++it) {
             std::ungetc(static_cast<unsigned char>(*it), m_file);
@@ -45,6 +45,8 @@ namespace scn {
             string_type falsename{};
             char_type decimal_point{};
             char_type thousands_separator{};
+
+            localized_number_format<CharT> number_format{};
         };
 
         template <typename CharT>
@@ -92,6 +94,24 @@ namespace scn {
             data.falsename = facet.falsename();
             data.decimal_point = facet.decimal_point();
             data.thousands_separator = facet.thousands_sep();
+
+            const auto& ctype =
+                std::use_facet<std::ctype<CharT>>(to_locale(*this));
+            auto& num = data.number_format;
+            const char src[] = "0123456789abcdefABCDEF";
+            ctype.widen(src, src + 22, num.digits);
+            num.plus_sign = ctype.widen('+');
+            num.minus_sign = ctype.widen('-');
+            num.thousands_separator = data.thousands_separator;
+            num.grouping = facet.grouping();
+
+            num.is_ascii = num.plus_sign == ascii_widen<CharT>('+') &&
+                           num.minus_sign == ascii_widen<CharT>('-');
+            for (int i = 0; i < 22; ++i) {
+                if (num.digits[i] != ascii_widen<CharT>(src[i])) {
+                    num.is_ascii = false;
+                }
+            }
         }
 
         template <typename CharT>
@@ -143,12 +163,14 @@ namespace scn {
         {
             m_locale =
                 &static_cast<locale_data<CharT>*>(m_data)->classic_locale;
+            _initialize();
         }
         template <typename CharT>
         void basic_custom_locale_ref<CharT>::convert_to_global()
         {
             SCN_EXPECT(m_data);
             m_locale = &static_cast<locale_data<CharT>*>(m_data)->global_locale;
+            _initialize();
         }
 
         template <typename CharT>
@@ -176,6 +198,12 @@ namespace scn {
                 ->thousands_separator;
         }
         template <typename CharT>
+        auto basic_custom_locale_ref<CharT>::number_format() const
+            -> const localized_number_format<CharT>&
+        {
+            return static_cast<locale_data<CharT>*>(m_data)->number_format;
+        }
+        template <typename CharT>
         auto basic_custom_locale_ref<CharT>::do_truename() const
             -> string_view_type
         {
@@ -22,8 +22,17 @@
 #include <scn/detail/args.h>
 #include <scn/reader/float.h>
 
+#include <algorithm>
 #include <cerrno>
 #include <clocale>
+#include <cstdlib>
+#include <cstring>
+#include <cwchar>
+#include <limits>
+
+#if SCN_HAS_STRTOD_L && (SCN_APPLE || defined(__FreeBSD__))
+#include <xlocale.h>
+#endif
 
 #if SCN_HAS_FLOAT_CHARCONV
 #include <charconv>
@@ -75,12 +84,10 @@ namespace scn {
             SCN_GCC_PUSH
             SCN_GCC_IGNORE("-Wnoexcept-type")
 #endif
+            // Calls f(str, end) with the global C locale temporarily set to
+            // "C". Not thread-safe: only used if strtod_l is not available.
             template <typename T, typename CharT, typename F>
-            expected<T> impl(F&& f_strtod,
-                             T huge_value,
-                             const CharT* str,
-                             size_t& chars,
-                             uint8_t options)
+            T with_global_c_locale(F&& f, const CharT* str, CharT** end)
             {
                 // Get current C locale
                 const auto loc = std::setlocale(LC_NUMERIC, nullptr);
@@ -93,14 +100,109 @@ namespace scn {
                 std::strcpy(locbuf, loc);
 
                 std::setlocale(LC_NUMERIC, "C");
+                T ret = f(str, end);
+                const auto err = errno;
+                // Reset locale
+                std::setlocale(LC_NUMERIC, locbuf);
+                errno = err;
+                return ret;
+            }
+
+#if SCN_HAS_STRTOD_L
+#if SCN_MSVC
+            using locale_type = _locale_t;
+#else
+            using locale_type = locale_t;
+#endif
+
+            // The "C" locale, created once, and shared between threads:
+            // strtod_l doesn't modify it
+            class c_locale {
+            public:
+                c_locale(const c_locale&) = delete;
+                c_locale& operator=(const c_locale&) = delete;
+
+                ~c_locale()
+                {
+                    if (m_loc) {
+#if SCN_MSVC
+                        _free_locale(m_loc);
+#else
+                        freelocale(m_loc);
+#endif
+                    }
+                }
+
+                // May return a null locale, if creating it failed
+                static locale_type get()
+                {
+                    static c_locale loc{};
+                    return loc.m_loc;
+                }
+
+            private:
+                c_locale()
+#if SCN_MSVC
+                    : m_loc(_create_locale(LC_NUMERIC, "C"))
+#else
+                    : m_loc(newlocale(LC_NUMERIC_MASK, "C", locale_type{}))
+#endif
+                {
+                }
+
+                locale_type m_loc;
+            };
+
+#if SCN_MSVC
+#define SCN_STRTOD_L(f) _##f##_l
+#else
+#define SCN_STRTOD_L(f) f##_l
+#endif
+#define SCN_DEFINE_C_STRTOD(f, T, CharT)             \
+    static T c_##f(const CharT* str, CharT** end)    \
+    {                                                \
+        if (auto loc = c_locale::get()) {            \
+            return SCN_STRTOD_L(f)(str, end, loc);   \
+        }                                            \
+        return with_global_c_locale<T>(f, str, end); \
+    }
+#else
+#define SCN_DEFINE_C_STRTOD(f, T, CharT)             \
+    static T c_##f(const CharT* str, CharT** end)    \
+    {                                                \
+        return with_global_c_locale<T>(f, str, end); \
+    }
+#endif
+
+            // c_strtod etc.: strtod etc., always using the "C" locale
+            SCN_DEFINE_C_STRTOD(strtof, float, char)
+            SCN_DEFINE_C_STRTOD(strtod, double, char)
+            SCN_DEFINE_C_STRTOD(strtold, long double, char)
+            SCN_DEFINE_C_STRTOD(wcstof, float, wchar_t)
+            SCN_DEFINE_C_STRTOD(wcstod, double, wchar_t)
+            SCN_DEFINE_C_STRTOD(wcstold, long double, wchar_t)
+
+#undef SCN_DEFINE_C_STRTOD
+#undef SCN_STRTOD_L
+
+            template <typename T, typename CharT, typename F>
+            expected<T> impl(F&& f_strtod,
+                             T huge_value,
+                             const CharT* first,
+                             size_t len,
+                             size_t& chars,
+                             uint8_t options)
+            {
+                // strtod needs a null-terminated string
+                detail::small_vector<CharT, 64> buf(len + 1);
+                std::copy(first, first + len, buf.begin());
+                const CharT* str = buf.data();
 
                 CharT* end{};
                 errno = 0;
                 T f = f_strtod(str, &end);
                 chars = static_cast<size_t>(end - str);
                 auto err = errno;
-                // Reset locale
-                std::setlocale(LC_NUMERIC, locbuf);
                 errno = 0;
 
                 SCN_GCC_COMPAT_PUSH
@@ -126,7 +228,7 @@ namespace scn {
                     // Subnormals cause ERANGE but a value is still returned
                 }
 
-                if (is_hexfloat(str, detail::strlen(str)) &&
+                if (is_hexfloat(str, len) &&
                     (options & detail::float_scanner<T>::allow_hex) == 0) {
                     return error(error::invalid_scanned_value,
                                  "Hexfloats not allowed by the format string");
@@ -145,78 +247,303 @@ namespace scn {
             template <>
             struct read<char, float> {
                 static expected<float> get(const char* str,
+                                           size_t len,
                                            size_t& chars,
                                            uint8_t options)
                 {
-                    return impl<float>(strtof, HUGE_VALF, str, chars, options);
+                    return impl<float>(c_strtof, HUGE_VALF, str, len, chars,
+                                       options);
                 }
             };
 
             template <>
             struct read<char, double> {
                 static expected<double> get(const char* str,
+                                            size_t len,
                                             size_t& chars,
                                             uint8_t options)
                 {
-                    return impl<double>(strtod, HUGE_VAL, str, chars, options);
+                    return impl<double>(c_strtod, HUGE_VAL, str, len, chars,
+                                        options);
                 }
             };
 
             template <>
             struct read<char, long double> {
                 static expected<long double> get(const char* str,
+                                                 size_t len,
                                                  size_t& chars,
                                                  uint8_t options)
                 {
-                    return impl<long double>(strtold, HUGE_VALL, str, chars,
-                                             options);
+                    return impl<long double>(c_strtold, HUGE_VALL, str, len,
+                                             chars, options);
                 }
             };
 
             template <>
             struct read<wchar_t, float> {
                 static expected<float> get(const wchar_t* str,
+                                           size_t len,
                                            size_t& chars,
                                            uint8_t options)
                 {
-                    return impl<float>(wcstof, HUGE_VALF, str, chars, options);
+                    return impl<float>(c_wcstof, HUGE_VALF, str, len, chars,
+                                       options);
                 }
             };
             template <>
             struct read<wchar_t, double> {
                 static expected<double> get(const wchar_t* str,
+                                            size_t len,
                                             size_t& chars,
                                             uint8_t options)
                 {
-                    return impl<double>(wcstod, HUGE_VAL, str, chars, options);
+                    return impl<double>(c_wcstod, HUGE_VAL, str, len, chars,
+                                        options);
                 }
             };
             template <>
             struct read<wchar_t, long double> {
                 static expected<long double> get(const wchar_t* str,
+                                                 size_t len,
                                                  size_t& chars,
                                                  uint8_t options)
                 {
-                    return impl<long double>(wcstold, HUGE_VALL, str, chars,
-                                             options);
+                    return impl<long double>(c_wcstold, HUGE_VALL, str, len,
+                                             chars, options);
                 }
             };
         }  // namespace cstd
 
+        namespace hexfloat {
+            template <typename T>
+            struct float_bits;
+            template <>
+            struct float_bits<float> {
+                using type = uint32_t;
+            };
+            template <>
+            struct float_bits<double> {
+                using type = uint64_t;
+            };
+
+            inline int bit_length(uint64_t n)
+            {
+                int len = 0;
+                for (; n >= 0x10; n >>= 4u) {
+                    len += 4;
+                }
+                for (; n != 0; n >>= 1u) {
+                    ++len;
+                }
+                return len;
+            }
+
+            template <typename CharT>
+            int hex_digit_value(CharT ch)
+            {
+                const auto c = static_cast<unsigned long>(ch);
+                if (c - '0' < 10) {
+                    return static_cast<int>(c - '0');
+                }
+                // ASCII: 'A' | 0x20 == 'a'
+                if ((c | 0x20) - 'a' < 6) {
+                    return static_cast<int>((c | 0x20) - 'a' + 10);
+                }
+                return -1;
+            }
+
+            // Parses a hexfloat (like "-0x1.8p3") from [str, str + len)
+            // into a float or a double, rounding to nearest, ties to even,
+            // like strtod does.
+            // The significant digits are collected into an integer, which is
+            // rounded once, and then placed into the bits of the result.
+            template <typename T, typename CharT>
+            expected<T> parse(const CharT* str, size_t len, size_t& chars)
+            {
+                static_assert(std::numeric_limits<T>::radix == 2 &&
+                                  std::numeric_limits<T>::digits <= 64,
+                              "hexfloat::parse requires a binary float type "
+                              "with at most 64 bits of precision");
+
+                const auto end = str + len;
+                auto it = str;
+
+                bool minus_sign = false;
+                if (it != end && (*it == '-' || *it == '+')) {
+                    minus_sign = *it == '-';
+                    ++it;
+                }
+                SCN_EXPECT(end - it >= 2 && it[0] == '0' &&
+                           (it[1] == 'x' || it[1] == 'X'));
+                // skip '0', and 'x' if it's followed by a digit:
+                // otherwise the value is just the zero
+                ++it;
+                const auto after_zero = it;
+                ++it;
+
+                // At most 16 hex digits (64 bits) fit into the mantissa,
+                // the following ones are only checked for being non-zero
+                uint64_t mantissa = 0;
+                int mantissa_digits = 0;
+                bool sticky = false;
+                // Binary exponent of the value, based on the digits
+                long exponent = 0;
+                // Keep the exponent bounded with extremely long inputs,
+                // these are far outside of the range of any T
+                constexpr long exponent_limit = 1L << 20;
+
+                bool any_digits = false;
+                bool seen_point = false;
+                for (; it != end; ++it) {
+                    if (*it == '.' && !seen_point) {
+                        seen_point = true;
+                        continue;
+                    }
+                    const auto digit = hex_digit_value(*it);
+                    if (digit < 0) {
+                        break;
+                    }
+                    any_digits = true;
+
+                    if (mantissa_digits < 16) {
+                        if (mantissa != 0 || digit != 0) {
+                            mantissa = (mantissa << 4u) |
+                                       static_cast<uint64_t>(digit);
+                            ++mantissa_digits;
+                        }
+                        if (seen_point && exponent > -exponent_limit) {
+                            exponent -= 4;
+                        }
+                    }
+                    else {
+                        sticky = sticky || digit != 0;
+                        if (!seen_point && exponent < exponent_limit) {
+                            exponent += 4;
+                        }
+                    }
+                }
+                if (!any_digits) {
+                    // "0x" not followed by hex digits -> the value is 0,
+                    // and reading stops at the 'x'
+                    chars = static_cast<size_t>(after_zero - str);
+                    return minus_sign ? -T{0} : T{0};
+                }
+
+                if (it != end && (*it == 'p' || *it == 'P')) {
+                    auto exp_it = it + 1;
+                    bool exp_minus = false;
+                    if (exp_it != end && (*exp_it == '-' || *exp_it == '+')) {
+                        exp_minus = *exp_it == '-';
+                        ++exp_it;
+                    }
+                    if (exp_it != end && *exp_it >= '0' && *exp_it <= '9') {
+                        long exp_value = 0;
+                        for (; exp_it != end && *exp_it >= '0' &&
+                               *exp_it <= '9';
+                             ++exp_it) {
+                            if (exp_value < exponent_limit) {
+                                exp_value = exp_value * 10 +
+                                            static_cast<long>(*exp_it - '0');
+                            }
+                        }
+                        exponent += exp_minus ? -exp_value : exp_value;
+                        it = exp_it;
+                    }
+                    // otherwise, the 'p' isn't a part of the value
+                }
+                chars = static_cast<size_t>(it - str);
+
+                if (mantissa == 0) {
+                    return minus_sign ? -T{0} : T{0};
+                }
+
+                using lim = std::numeric_limits<T>;
+                // Exponent of the leading bit: value is in [2^e, 2^(e+1))
+                const long leading_exponent =
+                    exponent + bit_length(mantissa) - 1;
+                if (leading_exponent >= lim::max_exponent) {
+                    return error(
+                        error::value_out_of_range,
+                        "Floating-point value out of range: overflow");
+                }
+
+                // Number of bits that can be kept: fewer for subnormals
+                long precision = lim::digits;
+                if (leading_exponent < lim::min_exponent - 1) {
+                    precision -= (lim::min_exponent - 1) - leading_exponent;
+                }
+
+                // Round (or shift) the mantissa to `precision` bits
+                const long shift = bit_length(mantissa) - precision;
+                uint64_t rounded = mantissa;
+                if (shift > bit_length(mantissa)) {
+                    // Less than half of the smallest subnormal
+                    rounded = 0;
+                }
+                else if (shift > 0) {
+                    const auto rest_mask =
+                        shift >= 64 ? ~uint64_t{0}
+                                    : (uint64_t{1} << shift) - 1;
+                    const auto half = uint64_t{1} << (shift - 1);
+                    const auto rest = mantissa & rest_mask;
+                    rounded = shift >= 64 ? 0 : mantissa >> shift;
+                    if (rest > half ||
+                        (rest == half && (sticky || (rounded & 1u) != 0))) {
+                        ++rounded;
+                    }
+                }
+                else {
+                    rounded <<= -shift;
+                }
+                if (rounded == 0) {
+                    return error(
+                        error::value_out_of_range,
+                        "Floating-point value out of range: underflow");
+                }
+
+                // Assemble the bits of the value:
+                // the leading bit of a normal `rounded` adds one to the
+                // biased exponent (and so does rounding up to the next power
+                // of two), a subnormal `rounded` has no leading bit
+                using bits_type = typename float_bits<T>::type;
+                const long biased_exponent =
+                    leading_exponent < lim::min_exponent - 1
+                        ? 0
+                        : leading_exponent + lim::max_exponent - 2;
+                const auto bits =
+                    (static_cast<bits_type>(biased_exponent)
+                     << static_cast<bits_type>(lim::digits - 1)) +
+                    static_cast<bits_type>(rounded);
+                if ((bits >> static_cast<bits_type>(lim::digits - 1)) >=
+                    static_cast<bits_type>(2 * lim::max_exponent - 1)) {
+                    // Rounded up to infinity
+                    return error(
+                        error::value_out_of_range,
+                        "Floating-point value out of range: overflow");
+                }
+
+                T value{};
+                std::memcpy(&value, &bits, sizeof(T));
+                return minus_sign ? -value : value;
+            }
+        }  // namespace hexfloat
+
         namespace from_chars {
 #if SCN_HAS_FLOAT_CHARCONV
             template <typename T>
             struct read {
                 static expected<T> get(const char* str,
+                                       size_t len,
                                        size_t& chars,
                                        uint8_t options)
                 {
-                    const auto len = std::strlen(str);
+                    auto first = str;
                     std::chars_format flags{};
                     if (((options & detail::float_scanner<T>::allow_hex) !=
                          0) &&
                         is_hexfloat(str, len)) {
-                        str += 2;
+                        first += 2;
                         flags = std::chars_format::hex;
                     }
                     else {
@@ -236,7 +563,7 @@ namespace scn {
 
                     T value{};
                     const auto result =
-                        std::from_chars(str, str + len, value, flags);
+                        std::from_chars(first, str + len, value, flags);
                     if (result.ec == std::errc::invalid_argument) {
                         return error(error::invalid_scanned_value,
                                      "from_chars");
@@ -244,7 +571,8 @@ namespace scn {
                     if (result.ec == std::errc::result_out_of_range) {
                         // Out of range, may be subnormal -> fall back to strtod
                         // On gcc std::from_chars doesn't parse subnormals
-                        return cstd::read<char, T>::get(str, chars, options);
+                        return cstd::read<char, T>::get(str, len, chars,
+                                                        options);
                     }
                     chars = static_cast<size_t>(result.ptr - str);
                     return value;
@@ -254,28 +582,188 @@ namespace scn {
             template <typename T>
             struct read {
                 static expected<T> get(const char* str,
+                                       size_t len,
                                        size_t& chars,
                                        uint8_t options)
                 {
                     // Fall straight back to strtod
-                    return cstd::read<char, T>::get(str, chars, options);
+                    return cstd::read<char, T>::get(str, len, chars, options);
                 }
             };
 #endif
         }  // namespace from_chars
 
+        namespace extended {
+            // Clinger's fast path for long double:
+            // if the decimal significand and the power of ten are both
+            // exactly representable, a single multiplication or division
+            // gives the correctly rounded result.
+            // Only enabled for 64-bit (x87) and 113-bit (quad) significands:
+            // IBM double-double (106 bits) isn't correctly rounded.
+            using limits = std::numeric_limits<long double>;
+
+            static constexpr int max_exact_pow10 =
+                limits::digits == 113 ? 48 : (limits::digits == 64 ? 27 : 0);
+            // 10^19 - 1 < 2^64
+            static constexpr int max_significand_digits = 19;
+
+            static const long double pow10[] = {
+                1e0L,  1e1L,  1e2L,  1e3L,  1e4L,  1e5L,  1e6L,  1e7L,
+                1e8L,  1e9L,  1e10L, 1e11L, 1e12L, 1e13L, 1e14L, 1e15L,
+                1e16L, 1e17L, 1e18L, 1e19L, 1e20L, 1e21L, 1e22L, 1e23L,
+                1e24L, 1e25L, 1e26L, 1e27L, 1e28L, 1e29L, 1e30L, 1e31L,
+                1e32L, 1e33L, 1e34L, 1e35L, 1e36L, 1e37L, 1e38L, 1e39L,
+                1e40L, 1e41L, 1e42L, 1e43L, 1e44L, 1e45L, 1e46L, 1e47L,
+                1e48L};
+
+            // x87 arithmetic may be set to round to double precision
+            // (precision control), which would make the fast path inexact
+            static bool has_full_precision()
+            {
+                SCN_GCC_COMPAT_PUSH
+                SCN_GCC_COMPAT_IGNORE("-Wfloat-equal")
+                static const bool value = [] {
+                    volatile long double one = 1.0L;
+                    volatile long double eps = limits::epsilon();
+                    volatile long double sum = one + eps;
+                    return sum - one == eps;
+                }();
+                SCN_GCC_COMPAT_POP
+                return value;
+            }
+
+            static bool is_digit(char ch)
+            {
+                return ch >= '0' && ch <= '9';
+            }
+
+            // Parses [sign]digits[.digits][(e|E)[sign]digits], like strtold.
+            // Returns false, if the value can't be parsed exactly with the
+            // fast path (too many digits, too large exponent, not a decimal
+            // number): the caller needs to fall back to strtold.
+            static bool fast_path(const char* str,
+                                  size_t len,
+                                  size_t& chars,
+                                  long double& value)
+            {
+                if (max_exact_pow10 == 0 || !has_full_precision()) {
+                    return false;
+                }
+
+                const char* it = str;
+                const char* const end = str + len;
+
+                bool negative = false;
+                if (it != end && (*it == '-' || *it == '+')) {
+                    negative = *it == '-';
+                    ++it;
+                }
+                if (is_hexfloat(it, static_cast<size_t>(end - it))) {
+                    return false;
+                }
+
+                uint64_t significand = 0;
+                int significand_digits = 0;
+                int exponent = 0;
+                bool has_digits = false;
+
+                for (; it != end && is_digit(*it); ++it) {
+                    has_digits = true;
+                    const auto digit = static_cast<uint64_t>(*it - '0');
+                    if (significand_digits < max_significand_digits) {
+                        significand = significand * 10 + digit;
+                        if (significand != 0) {
+                            ++significand_digits;
+                        }
+                    }
+                    else if (digit != 0) {
+                        return false;
+                    }
+                    else {
+                        ++exponent;
+                    }
+                }
+                if (it != end && *it == '.') {
+                    ++it;
+                    for (; it != end && is_digit(*it); ++it) {
+                        has_digits = true;
+                        const auto digit = static_cast<uint64_t>(*it - '0');
+                        if (significand_digits < max_significand_digits) {
+                            significand = significand * 10 + digit;
+                            if (significand != 0) {
+                                ++significand_digits;
+                            }
+                            --exponent;
+                        }
+                        else if (digit != 0) {
+                            return false;
+                        }
+                    }
+                }
+                if (!has_digits) {
+                    // inf, nan, or invalid
+                    return false;
+                }
+
+                if (it != end && (*it == 'e' || *it == 'E')) {
+                    const char* exp_it = it + 1;
+                    bool exp_negative = false;
+                    if (exp_it != end && (*exp_it == '-' || *exp_it == '+')) {
+                        exp_negative = *exp_it == '-';
+                        ++exp_it;
+                    }
+                    // An exponent without digits is not consumed
+                    if (exp_it != end && is_digit(*exp_it)) {
+                        int exp = 0;
+                        for (; exp_it != end && is_digit(*exp_it); ++exp_it) {
+                            if (exp < 100000) {
+                                exp = exp * 10 + (*exp_it - '0');
+                            }
+                        }
+                        exponent += exp_negative ? -exp : exp;
+                        it = exp_it;
+                    }
+                }
+                chars = static_cast<size_t>(it - str);
+
+                if (significand == 0) {
+                    value = negative ? -0.0L : 0.0L;
+                    return true;
+                }
+                if (exponent > max_exact_pow10 ||
+                    exponent < -max_exact_pow10) {
+                    return false;
+                }
+
+                value = static_cast<long double>(significand);
+                if (exponent < 0) {
+                    value /= pow10[-exponent];
+                }
+                else {
+                    value *= pow10[exponent];
+                }
+                if (negative) {
+                    value = -value;
+                }
+                return true;
+            }
+        }  // namespace extended
+
         namespace fast_float {
             template <typename T>
             expected<T> impl(const char* str,
+                             size_t len,
                              size_t& chars,
                              uint8_t options,
                              char locale_decimal_point)
             {
-                const auto len = std::strlen(str);
-                if (((options & detail::float_scanner<T>::allow_hex) != 0) &&
-                    is_hexfloat(str, len)) {
+                if ((options & detail::float_scanner<T>::allow_hex) != 0) {
                     // fast_float doesn't support hexfloats
-                    return from_chars::read<T>::get(str, chars, options);
+                    const size_t sign_len =
+                        (len != 0 && (str[0] == '-' || str[0] == '+')) ? 1 : 0;
+                    if (is_hexfloat(str + sign_len, len - sign_len)) {
+                        return hexfloat::parse<T>(str, len, chars);
+                    }
                 }
 
                 T value{};
@@ -306,7 +794,8 @@ namespace scn {
                     if (!(len >= 3 && (str[0] == 'i' || str[0] == 'I'))) {
                         // Input was not actually infinity ->
                         // invalid result, fall back to from_chars
-                        return from_chars::read<T>::get(str, chars, options);
+                        return from_chars::read<T>::get(str, len, chars,
+                                                        options);
                     }
                 }
                 chars = static_cast<size_t>(result.ptr - str);
@@ -319,35 +808,53 @@ namespace scn {
             template <>
             struct read<float> {
                 static expected<float> get(const char* str,
+                                           size_t len,
                                            size_t& chars,
                                            uint8_t options,
                                            char locale_decimal_point)
                 {
-                    return impl<float>(str, chars, options,
+                    return impl<float>(str, len, chars, options,
                                        locale_decimal_point);
                 }
             };
             template <>
             struct read<double> {
                 static expected<double> get(const char* str,
+                                            size_t len,
                                             size_t& chars,
                                             uint8_t options,
                                             char locale_decimal_points)
                 {
-                    return impl<double>(str, chars, options,
+                    return impl<double>(str, len, chars, options,
                                         locale_decimal_points);
                 }
             };
             template <>
             struct read<long double> {
                 static expected<long double> get(const char* str,
+                                                 size_t len,
                                                  size_t& chars,
                                                  uint8_t options,
-                                                 char)
+                                                 char locale_decimal_point)
                 {
-                    // Fallback to strtod
                     // fast_float doesn't support long double
-                    return cstd::read<char, long double>::get(str, chars,
+                    if (std::numeric_limits<long double>::digits ==
+                        std::numeric_limits<double>::digits) {
+                        // long double is double (MSVC):
+                        // parse as double, exactly
+                        auto ret = impl<double>(str, len, chars, options,
+                                                locale_decimal_point);
+                        if (!ret) {
+                            return ret.error();
+                        }
+                        return static_cast<long double>(ret.value());
+                    }
+
+                    long double value{};
+                    if (extended::fast_path(str, len, chars, value)) {
+                        return value;
+                    }
+                    return cstd::read<char, long double>::get(str, len, chars,
                                                               options);
                 }
             };
@@ -359,6 +866,7 @@ namespace scn {
         template <typename T>
         struct read<char, T> {
             static expected<T> get(const char* str,
+                                   size_t len,
                                    size_t& chars,
                                    uint8_t options,
                                    char locale_decimal_points)
@@ -366,19 +874,46 @@ namespace scn {
                 // char -> default to fast_float,
                 // fallback to strtod if necessary
                 return read_float::fast_float::read<T>::get(
-                    str, chars, options, locale_decimal_points);
+                    str, len, chars, options, locale_decimal_points);
             }
         };
         template <typename T>
         struct read<wchar_t, T> {
             static expected<T> get(const wchar_t* str,
+                                   size_t len,
                                    size_t& chars,
                                    uint8_t options,
-                                   wchar_t)
+                                   wchar_t locale_decimal_point)
             {
-                // wchar_t -> straight to strtod
-                return read_float::cstd::read<wchar_t, T>::get(str, chars,
-                                                               options);
+                if (!is_ascii(locale_decimal_point)) {
+                    // Can't be narrowed -> wcstod
+                    return read_float::cstd::read<wchar_t, T>::get(
+                        str, len, chars, options);
+                }
+
+                // wchar_t -> narrow, and then parse like a char:
+                // the characters of a float are all ASCII, so the value ends
+                // at the first non-ASCII character, at the latest.
+                // Every wchar_t is narrowed into a single char, so `chars` is
+                // the same for both
+                size_t ascii_len = 0;
+                while (ascii_len < len && is_ascii(str[ascii_len])) {
+                    ++ascii_len;
+                }
+                detail::small_vector<char, 64> buf(ascii_len);
+                std::transform(
+                    str, str + ascii_len, buf.begin(),
+                    [](wchar_t ch) { return static_cast<char>(ch); });
+
+                return read<char, T>::get(
+                    buf.data(), ascii_len, chars, options,
+                    static_cast<char>(locale_decimal_point));
+            }
+
+        private:
+            static constexpr bool is_ascii(wchar_t ch)
+            {
+                return static_cast<unsigned long>(ch) < 0x80;
             }
         };
     }  // namespace read_float
@@ -388,42 +923,57 @@ namespace scn {
         template <typename CharT>
         expected<T> float_scanner<T>::_read_float_impl(
             const CharT* str,
+            size_t len,
             size_t& chars,
             CharT locale_decimal_point)
         {
             // Parsing algorithm to use:
-            // If CharT == wchar_t -> strtod
+            // If CharT == wchar_t -> narrow into a char buffer, and use
+            // the char algorithm (strtod if the decimal point isn't ASCII)
             // If CharT == char:
-            //   1. fast_float
-            //      fallback if a hex float, or incorrectly parsed an inf
+            //   1. fast_float, or hexfloat::parse if a hex float
+            //      fallback if incorrectly parsed an inf
             //      (very large or small value)
             //   2. std::from_chars
             //      fallback if not available (C++17) or float is subnormal
             //   3. std::strtod
-            return read_float::read<CharT, T>::get(str, chars, format_options,
+            // Only the strtod fallback needs a null-terminated copy of the
+            // input
+            return read_float::read<CharT, T>::get(str, len, chars,
+                                                   format_options,
                                                    locale_decimal_point);
         }
 
 #if SCN_INCLUDE_SOURCE_DEFINITIONS
 
-        template expected<float>
-        float_scanner<float>::_read_float_impl(const char*, size_t&, char);
-        template expected<double>
-        float_scanner<double>::_read_float_impl(const char*, size_t&, char);
+        template expected<float> float_scanner<float>::_read_float_impl(
+            const char*,
+            size_t,
+            size_t&,
+            char);
+        template expected<double> float_scanner<double>::_read_float_impl(
+            const char*,
+            size_t,
+            size_t&,
+            char);
         template expected<long double>
         float_scanner<long double>::_read_float_impl(const char*,
+                                                     size_t,
                                                      size_t&,
                                                      char);
         template expected<float> float_scanner<float>::_read_float_impl(
             const wchar_t*,
+            size_t,
             size_t&,
             wchar_t);
         template expected<double> float_scanner<double>::_read_float_impl(
             const wchar_t*,
+            size_t,
             size_t&,
             wchar_t);
         template expected<long double>
         float_scanner<long double>::_read_float_impl(const wchar_t*,
+                                                     size_t,
                                                      size_t&,
                                                      wchar_t);
 #endif
@@ -21,6 +21,11 @@
 
 #include <scn/detail/args.h>
 #include <scn/reader/int.h>
+#include <scn/util/small_vector.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
 
 namespace scn {
     SCN_BEGIN_NAMESPACE
@@ -68,6 +73,527 @@ namespace scn {
             SCN_GCC_POP
         }
 
+        // SWAR (SIMD within a register) helpers for parsing eight decimal
+        // digits at once, see
+        // https://lemire.me/blog/2022/01/21/swar-explained-parsing-eight-digits/
+
+        SCN_NODISCARD static uint64_t _read_eight_chars(const char* p)
+        {
+            uint64_t v;
+            std::memcpy(&v, p, sizeof(uint64_t));
+            return v;
+        }
+        SCN_NODISCARD static bool _is_eight_digits(uint64_t v)
+        {
+            return ((v & 0xF0F0F0F0F0F0F0F0) |
+                    (((v + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) ==
+                   0x3333333333333333;
+        }
+        SCN_NODISCARD static uint64_t _parse_eight_digits(uint64_t v)
+        {
+            constexpr uint64_t mask = 0x000000FF000000FF;
+            constexpr uint64_t mul1 = 100 + (1000000ULL << 32);
+            constexpr uint64_t mul2 = 1 + (10000ULL << 32);
+            v -= 0x3030303030303030;
+            v = (v * 10) + (v >> 8);
+            return (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+        }
+
+        // Skips over blocks of eight decimal digits in [it, end)
+        static const char* _skip_decimal_swar(const char* it, const char* end)
+        {
+#if !SCN_IS_BIG_ENDIAN
+            while (end - it >= 8 && _is_eight_digits(_read_eight_chars(it))) {
+                it += 8;
+            }
+#else
+            SCN_UNUSED(end);
+#endif
+            return it;
+        }
+        static const wchar_t* _skip_decimal_swar(const wchar_t* it,
+                                                 const wchar_t*)
+        {
+            return it;
+        }
+
+        // Accumulates blocks of eight decimal digits from [it, end) into
+        // tmp. Every character in the range must be a digit, and the result
+        // must fit in UT.
+        template <typename UT>
+        static const char* _parse_decimal_swar(UT& tmp,
+                                               const char* it,
+                                               const char* end)
+        {
+#if !SCN_IS_BIG_ENDIAN
+            uint64_t acc = tmp;
+            for (; end - it >= 8; it += 8) {
+                acc = acc * 100000000 +
+                      _parse_eight_digits(_read_eight_chars(it));
+            }
+            tmp = static_cast<UT>(acc);
+#else
+            SCN_UNUSED(tmp);
+            SCN_UNUSED(end);
+#endif
+            return it;
+        }
+        template <typename UT>
+        static const wchar_t* _parse_decimal_swar(UT&,
+                                                  const wchar_t* it,
+                                                  const wchar_t*)
+        {
+            return it;
+        }
+
+        // Number of digits in base Base, that can always be accumulated
+        // into an integer with the maximum value Max without overflow.
+        // Base == 0 means a base only known at runtime.
+        template <typename UT, UT Max, unsigned Base>
+        struct _safe_digits {
+            static int get(UT)
+            {
+                return std::integral_constant<
+                    int, safe_digits<UT>(Max, static_cast<UT>(Base))>::value;
+            }
+        };
+        template <typename UT, UT Max>
+        struct _safe_digits<UT, Max, 0> {
+            static int get(UT base)
+            {
+                return safe_digits<UT>(Max, base);
+            }
+        };
+
+        // log2(Base), if Base is a power of two, 0 otherwise
+        constexpr unsigned _base_shift(unsigned base, unsigned shift = 0)
+        {
+            return base < 2 || (base & 1) != 0
+                       ? 0
+                       : (base == 2 ? shift + 1
+                                    : _base_shift(base >> 1, shift + 1));
+        }
+
+        template <unsigned Base, typename UT>
+        static UT _accumulate_digit(UT tmp, UT ubase, unsigned char digit)
+        {
+            SCN_GCC_PUSH
+            SCN_GCC_IGNORE("-Wconversion")
+            SCN_CLANG_PUSH
+            SCN_CLANG_IGNORE("-Wconversion")
+            SCN_MSVC_PUSH
+            SCN_MSVC_IGNORE(4127)  // conditional expression is constant
+            SCN_MSVC_IGNORE(4244)  // lossy conversion
+
+            if (_base_shift(Base) != 0) {
+                return static_cast<UT>(tmp << _base_shift(Base)) | digit;
+            }
+            return tmp * ubase + digit;
+
+            SCN_MSVC_POP
+            SCN_CLANG_POP
+            SCN_GCC_POP
+        }
+
+        // Accumulates the digits in [it, end) into tmp,
+        // without checking for overflow
+        template <unsigned Base, typename UT, typename CharT>
+        static const CharT* _accumulate_digits(UT& tmp,
+                                               UT ubase,
+                                               const CharT* it,
+                                               const CharT* end,
+                                               std::false_type)
+        {
+            SCN_MSVC_PUSH
+            SCN_MSVC_IGNORE(4127)  // conditional expression is constant
+
+            if (Base == 10) {
+                it = _parse_decimal_swar(tmp, it, end);
+            }
+            for (; it != end; ++it) {
+                tmp = _accumulate_digit<Base>(tmp, ubase, _char_to_int(*it));
+            }
+            return it;
+
+            SCN_MSVC_POP
+        }
+
+        // Same as above, for integers wider than 64 bits:
+        // the digits are accumulated in 64-bit chunks,
+        // so that wide arithmetic is only needed to combine the chunks
+        template <unsigned Base, typename UT, typename CharT>
+        static const CharT* _accumulate_digits(UT& tmp,
+                                               UT ubase,
+                                               const CharT* it,
+                                               const CharT* end,
+                                               std::true_type)
+        {
+            SCN_GCC_PUSH
+            SCN_GCC_IGNORE("-Wconversion")
+            SCN_GCC_IGNORE("-Wsign-conversion")
+            SCN_CLANG_PUSH
+            SCN_CLANG_IGNORE("-Wconversion")
+            SCN_CLANG_IGNORE("-Wsign-conversion")
+
+            static constexpr uint64_t pow10[] = {1ull,
+                                                 10ull,
+                                                 100ull,
+                                                 1000ull,
+                                                 10000ull,
+                                                 100000ull,
+                                                 1000000ull,
+                                                 10000000ull,
+                                                 100000000ull,
+                                                 1000000000ull,
+                                                 10000000000ull,
+                                                 100000000000ull,
+                                                 1000000000000ull,
+                                                 10000000000000ull,
+                                                 100000000000000ull,
+                                                 1000000000000000ull,
+                                                 10000000000000000ull,
+                                                 100000000000000000ull,
+                                                 1000000000000000000ull,
+                                                 10000000000000000000ull};
+
+            constexpr auto chunk_max = static_cast<uint64_t>(-1);
+            const auto chunk_len = static_cast<std::ptrdiff_t>(
+                _safe_digits<uint64_t, chunk_max, Base>::get(ubase));
+
+            while (it != end) {
+                const auto n = (std::min)(chunk_len, end - it);
+                uint64_t chunk = 0;
+                it = _accumulate_digits<Base>(chunk,
+                                              static_cast<uint64_t>(ubase), it,
+                                              it + n, std::false_type{});
+
+                if (_base_shift(Base) != 0) {
+                    tmp = (tmp << (_base_shift(Base) * n)) | chunk;
+                }
+                else if (Base == 10) {
+                    tmp = tmp * pow10[n] + chunk;
+                }
+                else {
+                    UT mul = 1;
+                    for (std::ptrdiff_t i = 0; i < n; ++i) {
+                        mul *= ubase;
+                    }
+                    tmp = tmp * mul + chunk;
+                }
+            }
+            return it;
+
+            SCN_CLANG_POP
+            SCN_GCC_POP
+        }
+
+        // Stores the absolute value tmp into val, negated if minus_sign.
+        // Negation can only overflow for signed types not narrower than
+        // int: narrower ones are promoted, and unsigned ones wrap around.
+        template <typename T>
+        static void _store_int(T& val,
+                               typename make_unsigned_integer<T>::type tmp,
+                               bool minus_sign,
+                               std::false_type)
+        {
+            SCN_GCC_PUSH
+            SCN_GCC_IGNORE("-Wconversion")
+            SCN_GCC_IGNORE("-Wsign-conversion")
+            SCN_CLANG_PUSH
+            SCN_CLANG_IGNORE("-Wconversion")
+            SCN_CLANG_IGNORE("-Wsign-conversion")
+            SCN_MSVC_PUSH
+            SCN_MSVC_IGNORE(4146)  // unary minus applied to unsigned type
+
+            val = static_cast<T>(tmp);
+            if (minus_sign) {
+                val = static_cast<T>(-val);
+            }
+
+            SCN_MSVC_POP
+            SCN_CLANG_POP
+            SCN_GCC_POP
+        }
+        template <typename T>
+        static void _store_int(T& val,
+                               typename make_unsigned_integer<T>::type tmp,
+                               bool minus_sign,
+                               std::true_type)
+        {
+            SCN_GCC_PUSH
+            SCN_GCC_IGNORE("-Wconversion")
+            SCN_GCC_IGNORE("-Wsign-conversion")
+            SCN_CLANG_PUSH
+            SCN_CLANG_IGNORE("-Wconversion")
+            SCN_CLANG_IGNORE("-Wsign-conversion")
+
+            using utype = typename make_unsigned_integer<T>::type;
+            constexpr auto abs_int_min =
+                static_cast<utype>(static_cast<utype>(-1) / 2 + 1);
+
+            if (minus_sign) {
+                // special case: signed int minimum's absolute value can't
+                // be represented with the same type
+                //
+                // For example, int -- range is [-2147483648, 2147483647],
+                // 2147483648 can't be represented
+                //
+                // In that case, -static_cast<T>(tmp) would trigger UB
+                if (SCN_UNLIKELY(tmp == abs_int_min)) {
+                    val = -static_cast<T>(tmp - 1) - 1;
+                }
+                else {
+                    val = -static_cast<T>(tmp);
+                }
+            }
+            else {
+                val = static_cast<T>(tmp);
+            }
+
+            SCN_CLANG_POP
+            SCN_GCC_POP
+        }
+        template <typename T>
+        static void _store_int(T& val,
+                               typename make_unsigned_integer<T>::type tmp,
+                               bool minus_sign)
+        {
+            _store_int(val, tmp, minus_sign,
+                       std::integral_constant<bool,
+                                              is_signed_integer<T>::value &&
+                                                  (sizeof(T) >=
+                                                   sizeof(int))>{});
+        }
+
+        // Parses the digits of an integer in base Base (or in base `base`,
+        // if Base == 0).
+        template <unsigned Base, typename T, typename CharT>
+        static expected<const CharT*> _parse_int_digits(T& val,
+                                                        bool minus_sign,
+                                                        const CharT* it,
+                                                        const CharT* end,
+                                                        uint8_t base)
+        {
+            SCN_GCC_PUSH
+            SCN_GCC_IGNORE("-Wconversion")
+            SCN_GCC_IGNORE("-Wsign-conversion")
+            SCN_GCC_IGNORE("-Wsign-compare")
+
+            SCN_CLANG_PUSH
+            SCN_CLANG_IGNORE("-Wconversion")
+            SCN_CLANG_IGNORE("-Wsign-conversion")
+            SCN_CLANG_IGNORE("-Wsign-compare")
+
+            SCN_MSVC_PUSH
+            SCN_MSVC_IGNORE(4018)  // > signed/unsigned mismatch
+            SCN_MSVC_IGNORE(4389)  // == signed/unsigned mismatch
+            SCN_MSVC_IGNORE(4244)  // lossy conversion
+            SCN_MSVC_IGNORE(4127)  // conditional expression is constant
+
+            using utype = typename make_unsigned_integer<T>::type;
+
+            const auto ubase = static_cast<utype>(Base != 0 ? Base : base);
+            SCN_ASSUME(ubase > 0);
+
+            constexpr auto uint_max = static_cast<utype>(-1);
+            constexpr auto int_max = static_cast<utype>(uint_max >> 1);
+            constexpr auto abs_int_min = static_cast<utype>(int_max + 1);
+
+            constexpr auto safe_max =
+                is_signed_integer<T>::value ? int_max : uint_max;
+
+            // Find the end of the digit run first:
+            // its length tells us, whether overflow is possible
+            auto digits_end = it;
+            if (Base == 10) {
+                digits_end = _skip_decimal_swar(digits_end, end);
+            }
+            for (; digits_end != end; ++digits_end) {
+                if (_char_to_int(*digits_end) >= ubase) {
+                    break;
+                }
+            }
+            // Leading zeroes don't contribute to the value
+            while (it != digits_end && *it == ascii_widen<CharT>('0')) {
+                ++it;
+            }
+
+            // Every number with at most safe_len digits fits in T,
+            // and every number with more than safe_len + 1 digits doesn't
+            const auto safe_len = _safe_digits<utype, safe_max, Base>::get(ubase);
+            const auto len = digits_end - it;
+            if (SCN_UNLIKELY(len > safe_len + 1)) {
+                if (!minus_sign) {
+                    return error(error::value_out_of_range,
+                                 "Out of range: integer overflow");
+                }
+                return error(error::value_out_of_range,
+                             "Out of range: integer underflow");
+            }
+
+            const auto unchecked_end = len > safe_len ? it + safe_len
+                                                      : digits_end;
+            utype tmp = 0;
+            it = _accumulate_digits<Base>(
+                tmp, ubase, it, unchecked_end,
+                std::integral_constant<bool, (sizeof(utype) >
+                                              sizeof(uint64_t))>{});
+
+            if (it != digits_end) {
+                // Exactly one digit left, that can overflow
+                const auto limit = [&]() -> utype {
+                    if (is_signed_integer<T>::value) {
+                        if (minus_sign) {
+                            return abs_int_min;
+                        }
+                        return int_max;
+                    }
+                    return uint_max;
+                }();
+                const auto cut = div(limit, ubase);
+                const auto digit = _char_to_int(*it);
+                if (SCN_UNLIKELY(tmp > cut.first ||
+                                 (tmp == cut.first && digit > cut.second))) {
+                    if (!minus_sign) {
+                        return error(error::value_out_of_range,
+                                     "Out of range: integer overflow");
+                    }
+                    return error(error::value_out_of_range,
+                                 "Out of range: integer underflow");
+                }
+                tmp = _accumulate_digit<Base>(tmp, ubase, digit);
+                ++it;
+            }
+            _store_int(val, tmp, minus_sign);
+            return it;
+
+            SCN_MSVC_POP
+            SCN_CLANG_POP
+            SCN_GCC_POP
+        }
+
+        // Like _parse_int_digits, but skips over thousands separators
+        // between digits. The digit count doesn't tell anything about
+        // overflow here, so every digit is checked.
+        template <unsigned Base, typename T, typename CharT>
+        static expected<const CharT*> _parse_grouped_int_digits(
+            T& val,
+            bool minus_sign,
+            const CharT* it,
+            const CharT* end,
+            uint8_t base,
+            CharT thsep)
+        {
+            SCN_GCC_PUSH
+            SCN_GCC_IGNORE("-Wconversion")
+            SCN_GCC_IGNORE("-Wsign-conversion")
+            SCN_GCC_IGNORE("-Wsign-compare")
+
+            SCN_CLANG_PUSH
+            SCN_CLANG_IGNORE("-Wconversion")
+            SCN_CLANG_IGNORE("-Wsign-conversion")
+            SCN_CLANG_IGNORE("-Wsign-compare")
+
+            SCN_MSVC_PUSH
+            SCN_MSVC_IGNORE(4018)  // > signed/unsigned mismatch
+            SCN_MSVC_IGNORE(4389)  // == signed/unsigned mismatch
+            SCN_MSVC_IGNORE(4244)  // lossy conversion
+
+            using utype = typename make_unsigned_integer<T>::type;
+
+            const auto ubase = static_cast<utype>(Base != 0 ? Base : base);
+            SCN_ASSUME(ubase > 0);
+
+            constexpr auto uint_max = static_cast<utype>(-1);
+            constexpr auto int_max = static_cast<utype>(uint_max >> 1);
+            constexpr auto abs_int_min = static_cast<utype>(int_max + 1);
+
+            const auto cut = div(
+                [&]() -> utype {
+                    if (is_signed_integer<T>::value) {
+                        if (minus_sign) {
+                            return abs_int_min;
+                        }
+                        return int_max;
+                    }
+                    return uint_max;
+                }(),
+                ubase);
+
+            const auto begin = it;
+            utype tmp = 0;
+            for (; it != end; ++it) {
+                if (*it == thsep) {
+                    // A separator is only a part of the number,
+                    // if it's surrounded by digits
+                    if (it == begin || end - it < 2 ||
+                        _char_to_int(*(it + 1)) >= ubase) {
+                        break;
+                    }
+                    continue;
+                }
+                const auto digit = _char_to_int(*it);
+                if (digit >= ubase) {
+                    break;
+                }
+                if (SCN_UNLIKELY(tmp > cut.first ||
+                                 (tmp == cut.first && digit > cut.second))) {
+                    if (!minus_sign) {
+                        return error(error::value_out_of_range,
+                                     "Out of range: integer overflow");
+                    }
+                    return error(error::value_out_of_range,
+                                 "Out of range: integer underflow");
+                }
+                tmp = _accumulate_digit<Base>(tmp, ubase, digit);
+            }
+            _store_int(val, tmp, minus_sign);
+            return it;
+
+            SCN_MSVC_POP
+            SCN_CLANG_POP
+            SCN_GCC_POP
+        }
+
+        // Checks the thousands separators in the number [begin, end)
+        // against the grouping rules of numpunct::grouping()
+        template <typename CharT>
+        static bool _check_grouping(const CharT* begin,
+                                    const CharT* end,
+                                    CharT thsep,
+                                    const std::string& grouping,
+                                    unsigned base)
+        {
+            auto group_size = [&](std::size_t i) -> int {
+                const auto g = static_cast<int>(
+                    grouping[(std::min)(i, grouping.size() - 1)]);
+                // Zero, negative or CHAR_MAX -> unlimited
+                return g <= 0 || g == CHAR_MAX ? INT_MAX : g;
+            };
+
+            // Groups are counted from the right
+            std::size_t group_index = 0;
+            int digits = 0;
+            for (auto it = end; it != begin;) {
+                --it;
+                if (*it == thsep) {
+                    if (digits != group_size(group_index)) {
+                        return false;
+                    }
+                    ++group_index;
+                    digits = 0;
+                    continue;
+                }
+                if (_char_to_int(*it) >= base) {
+                    // Sign or base prefix
+                    break;
+                }
+                ++digits;
+            }
+            // The leftmost group can be shorter
+            return group_index == 0 || digits <= group_size(group_index);
+        }
+
         template <typename T>
         template <typename CharT>
         expected<typename span<const CharT>::iterator>
@@ -156,7 +682,9 @@ namespace scn {
         template <typename CharT>
         expected<std::ptrdiff_t> integer_scanner<T>::_parse_int(
             T& val,
-            span<const CharT> s)
+            span<const CharT> s,
+            bool accept_thsep,
+            CharT thsep)
         {
             SCN_EXPECT(s.size() > 0);
 
@@ -164,7 +692,7 @@ namespace scn {
             SCN_MSVC_IGNORE(4244)
             SCN_MSVC_IGNORE(4127)  // conditional expression is constant
 
-            if (std::is_unsigned<T>::value) {
+            if (!is_signed_integer<T>::value) {
                 if (s[0] == detail::ascii_widen<CharT>('-')) {
                     return error(error::invalid_scanned_value,
                                  "Unexpected sign '-' when scanning an "
@@ -197,6 +725,8 @@ namespace scn {
                 return error(error::invalid_scanned_value,
                              "Expected number after sign");
             }
+            // At least one digit has to follow the sign and the base prefix
+            auto digits_begin = it;
 
             // Format string was 'i' or empty -> detect base
             // or
@@ -220,6 +750,11 @@ namespace scn {
                 if (base == 0) {
                     base = static_cast<uint8_t>(b);
                 }
+                // A lone leading '0' (octal) is a digit itself,
+                // 0x, 0b and 0o aren't
+                if (r.value() - it == 2) {
+                    digits_begin = r.value();
+                }
                 it = r.value();
             }
 
@@ -236,15 +771,16 @@ namespace scn {
             SCN_ASSUME(base > 0);
 
             SCN_CLANG_PUSH_IGNORE_UNDEFINED_TEMPLATE
-            auto r = _parse_int_impl(tmp, minus_sign, make_span(it, s.end()));
+            auto r = _parse_int_impl(tmp, minus_sign, make_span(it, s.end()),
+                                     accept_thsep, thsep);
             SCN_CLANG_POP_IGNORE_UNDEFINED_TEMPLATE
             if (!r) {
                 return r.error();
             }
-            it = r.value();
-            if (s.begin() == it) {
+            if (r.value() == digits_begin) {
                 return error(error::invalid_scanned_value, "custom::read_int");
             }
+            it = r.value();
             val = tmp;
             return ranges::distance(s.begin(), it);
 
@@ -252,89 +788,241 @@ namespace scn {
             SCN_GCC_POP
         }
 
+        template <typename T>
+        template <typename CharT>
+        expected<std::ptrdiff_t> integer_scanner<T>::_parse_localized_int(
+            T& val,
+            span<const CharT> s,
+            const localized_number_format<CharT>& fmt)
+        {
+            SCN_EXPECT(s.size() > 0);
+
+            // Translate the number to the "C" representation, one character
+            // at a time, up to the first character that can't be a part of
+            // it. Nearly every locale uses ASCII digits, so this is rarely
+            // needed.
+            small_vector<CharT, 64> translated;
+            if (SCN_UNLIKELY(!fmt.is_ascii)) {
+                constexpr char digits[] = "0123456789abcdefABCDEF";
+                for (auto ch : s) {
+                    const auto d = fmt.digit_value(ch);
+                    if (d != 255) {
+                        translated.push_back(ascii_widen<CharT>(digits[d]));
+                    }
+                    else if (ch == fmt.minus_sign) {
+                        translated.push_back(ascii_widen<CharT>('-'));
+                    }
+                    else if (ch == fmt.plus_sign) {
+                        translated.push_back(ascii_widen<CharT>('+'));
+                    }
+                    else if (ch == fmt.thousands_separator ||
+                             ch == ascii_widen<CharT>('x') ||
+                             ch == ascii_widen<CharT>('X') ||
+                             ch == ascii_widen<CharT>('o') ||
+                             ch == ascii_widen<CharT>('O') ||
+                             ch == ascii_widen<CharT>('b') ||
+                             ch == ascii_widen<CharT>('B')) {
+                        translated.push_back(ch);
+                    }
+                    else {
+                        break;
+                    }
+                }
+                if (translated.empty()) {
+                    return error(error::invalid_scanned_value,
+                                 "Invalid localized integer");
+                }
+                s = make_span(translated.data(), translated.size());
+            }
+
+            // Digit grouping is always accepted,
+            // if the locale defines it
+            T tmp{};
+            auto ret = _parse_int(tmp, s, !fmt.grouping.empty(),
+                                  fmt.thousands_separator);
+            if (!ret) {
+                return ret;
+            }
+
+            // base == 0 -> only a '0' was read
+            if (base != 0 && base != 8 && base != 10 && base != 16) {
+                return error(error::invalid_scanned_value,
+                             "Localized values have to be in base 8, 10 or 16");
+            }
+            if (!fmt.grouping.empty() &&
+                !_check_grouping(s.begin(), s.begin() + ret.value(),
+                                 fmt.thousands_separator, fmt.grouping,
+                                 base)) {
+                return error(error::invalid_scanned_value,
+                             "Invalid digit grouping");
+            }
+            val = tmp;
+            return ret;
+        }
+
         template <typename T>
         template <typename CharT>
         expected<typename span<const CharT>::iterator>
         integer_scanner<T>::_parse_int_impl(T& val,
                                             bool minus_sign,
-                                            span<const CharT> buf) const
+                                            span<const CharT> buf,
+                                            bool accept_thsep,
+                                            CharT thsep) const
         {
+            const auto it = buf.begin();
+            const auto end = buf.end();
+
+            // Dispatch once to a kernel with a compile-time base,
+            // custom bases use the generic one
+            if (SCN_UNLIKELY(accept_thsep)) {
+                switch (base) {
+                    case 10:
+                        return _parse_grouped_int_digits<10>(
+                            val, minus_sign, it, end, base, thsep);
+                    case 16:
+                        return _parse_grouped_int_digits<16>(
+                            val, minus_sign, it, end, base, thsep);
+                    case 8:
+                        return _parse_grouped_int_digits<8>(
+                            val, minus_sign, it, end, base, thsep);
+                    case 2:
+                        return _parse_grouped_int_digits<2>(
+                            val, minus_sign, it, end, base, thsep);
+                    default:
+                        return _parse_grouped_int_digits<0>(
+                            val, minus_sign, it, end, base, thsep);
+                }
+            }
+
+            switch (base) {
+                case 10:
+                    return _parse_int_digits<10>(val, minus_sign, it, end,
+                                                 base);
+                case 16:
+                    return _parse_int_digits<16>(val, minus_sign, it, end,
+                                                 base);
+                case 8:
+                    return _parse_int_digits<8>(val, minus_sign, it, end,
+                                                base);
+                case 2:
+                    return _parse_int_digits<2>(val, minus_sign, it, end,
+                                                base);
+                default:
+                    return _parse_int_digits<0>(val, minus_sign, it, end,
+                                                base);
+            }
+        }
+
+        template <typename T>
+        template <typename CharT>
+        expected<std::ptrdiff_t> fixed_point_scanner<T>::_parse_fixed_point(
+            T& val,
+            span<const CharT> s,
+            CharT decimal_point) const
+        {
+            SCN_EXPECT(s.size() > 0);
+
             SCN_GCC_PUSH
             SCN_GCC_IGNORE("-Wconversion")
             SCN_GCC_IGNORE("-Wsign-conversion")
-            SCN_GCC_IGNORE("-Wsign-compare")
 
             SCN_CLANG_PUSH
             SCN_CLANG_IGNORE("-Wconversion")
             SCN_CLANG_IGNORE("-Wsign-conversion")
-            SCN_CLANG_IGNORE("-Wsign-compare")
 
             SCN_MSVC_PUSH
-            SCN_MSVC_IGNORE(4018)  // > signed/unsigned mismatch
-            SCN_MSVC_IGNORE(4389)  // == signed/unsigned mismatch
             SCN_MSVC_IGNORE(4244)  // lossy conversion
+            SCN_MSVC_IGNORE(4127)  // conditional expression is constant
 
-            using utype = typename std::make_unsigned<T>::type;
-
-            const auto ubase = static_cast<utype>(base);
-            SCN_ASSUME(ubase > 0);
-
-            constexpr auto uint_max = static_cast<utype>(-1);
-            constexpr auto int_max = static_cast<utype>(uint_max >> 1);
-            constexpr auto abs_int_min = static_cast<utype>(int_max + 1);
+            using utype = typename make_unsigned_integer<T>::type;
 
-            const auto cut = div(
-                [&]() -> utype {
-                    if (std::is_signed<T>::value) {
-                        if (minus_sign) {
-                            return abs_int_min;
-                        }
-                        return int_max;
-                    }
-                    return uint_max;
-                }(),
-                ubase);
-            const auto cutoff = cut.first;
-            const auto cutlim = cut.second;
+            const CharT* it = s.data();
+            const CharT* const end = s.data() + s.size();
 
-            auto it = buf.begin();
-            const auto end = buf.end();
-            utype tmp = 0;
-            for (; it != end; ++it) {
-                const auto digit = _char_to_int(*it);
-                if (digit >= ubase) {
-                    break;
+            bool minus_sign = false;
+            if (*it == ascii_widen<CharT>('-')) {
+                if (!is_signed_integer<T>::value) {
+                    return error(error::invalid_scanned_value,
+                                 "Unexpected sign '-' when scanning an "
+                                 "unsigned fixed-point number");
                 }
-                if (SCN_UNLIKELY(tmp > cutoff ||
-                                 (tmp == cutoff && digit > cutlim))) {
-                    if (!minus_sign) {
-                        return error(error::value_out_of_range,
-                                     "Out of range: integer overflow");
-                    }
+                minus_sign = true;
+                ++it;
+            }
+            else if (*it == ascii_widen<CharT>('+')) {
+                ++it;
+            }
+
+            // Both parts are read as absolute values,
+            // with the same kernels as integers
+            utype int_part = 0;
+            auto r = _parse_int_digits<10>(int_part, false, it, end, 10);
+            if (!r) {
+                if (minus_sign) {
                     return error(error::value_out_of_range,
                                  "Out of range: integer underflow");
                 }
-                tmp = tmp * ubase + digit;
+                return r.error();
             }
-            if (minus_sign) {
-                // special case: signed int minimum's absolute value can't
-                // be represented with the same type
-                //
-                // For example, short int -- range is [-32768, 32767], 32768
-                // can't be represented
-                //
-                // In that case, -static_cast<T>(tmp) would trigger UB
-                if (SCN_UNLIKELY(tmp == abs_int_min)) {
-                    val = std::numeric_limits<T>::min();
+            const bool has_int_digits = r.value() != it;
+            it = r.value();
+
+            utype frac_part = 0;
+            bool has_frac_digits = false;
+            if (it != end && *it == decimal_point && end - it > 1 &&
+                _char_to_int(it[1]) < 10) {
+                ++it;
+                has_frac_digits = true;
+
+                const auto frac_end = it + std::min<std::ptrdiff_t>(
+                                               end - it, scale);
+                r = _parse_int_digits<10>(frac_part, false, it, frac_end, 10);
+                if (!r) {
+                    return r.error();
                 }
-                else {
-                    val = -static_cast<T>(tmp);
+                // Pad to `scale` digits: "1.5" with scale 3 is 1500
+                for (auto n = r.value() - it; n < scale; ++n) {
+                    frac_part *= 10;
+                }
+                it = r.value();
+
+                // Digits beyond `scale` can't be represented
+                for (; it != end && _char_to_int(*it) < 10; ++it) {
+                    if (*it != ascii_widen<CharT>('0')) {
+                        return error(error::invalid_scanned_value,
+                                     "Too many digits after the decimal "
+                                     "point for a fixed-point number");
+                    }
                 }
             }
-            else {
-                val = static_cast<T>(tmp);
+
+            if (!has_int_digits && !has_frac_digits) {
+                return error(error::invalid_scanned_value,
+                             "Expected a fixed-point number");
             }
-            return it;
+
+            // int_part * 10^scale + frac_part <= limit
+            constexpr auto uint_max = static_cast<utype>(-1);
+            constexpr auto int_max = static_cast<utype>(uint_max >> 1);
+            const utype limit =
+                is_signed_integer<T>::value
+                    ? (minus_sign ? static_cast<utype>(int_max + 1) : int_max)
+                    : uint_max;
+            utype multiplier = 1;
+            for (uint8_t i = 0; i < scale; ++i) {
+                multiplier *= 10;
+            }
+            if (SCN_UNLIKELY(int_part > (limit - frac_part) / multiplier)) {
+                if (!minus_sign) {
+                    return error(error::value_out_of_range,
+                                 "Out of range: integer overflow");
+                }
+                return error(error::value_out_of_range,
+                             "Out of range: integer underflow");
+            }
+
+            _store_int(val, int_part * multiplier + frac_part, minus_sign);
+            return it - s.data();
 
             SCN_MSVC_POP
             SCN_CLANG_POP
@@ -345,10 +1033,16 @@ namespace scn {
 
 #define SCN_DEFINE_INTEGER_SCANNER_MEMBERS_IMPL(CharT, T)             \
     template expected<std::ptrdiff_t> integer_scanner<T>::_parse_int( \
-        T& val, span<const CharT> s);                                 \
+        T& val, span<const CharT> s, bool accept_thsep, CharT thsep); \
     template expected<typename span<const CharT>::iterator>           \
     integer_scanner<T>::_parse_int_impl(T& val, bool minus_sign,      \
-                                        span<const CharT> buf) const; \
+                                        span<const CharT> buf,        \
+                                        bool accept_thsep,            \
+                                        CharT thsep) const;           \
+    template expected<std::ptrdiff_t>                                 \
+    integer_scanner<T>::_parse_localized_int(                         \
+        T& val, span<const CharT> s,                                  \
+        const localized_number_format<CharT>& fmt);                   \
     template expected<typename span<const CharT>::iterator>           \
     integer_scanner<T>::parse_base_prefix(span<const CharT>, int&) const;
 
@@ -369,6 +1063,40 @@ namespace scn {
         SCN_DEFINE_INTEGER_SCANNER_MEMBERS(char)
         SCN_DEFINE_INTEGER_SCANNER_MEMBERS(wchar_t)
 
+#if SCN_HAS_INT128
+        SCN_DEFINE_INTEGER_SCANNER_MEMBERS_IMPL(char, int128)
+        SCN_DEFINE_INTEGER_SCANNER_MEMBERS_IMPL(char, uint128)
+        SCN_DEFINE_INTEGER_SCANNER_MEMBERS_IMPL(wchar_t, int128)
+        SCN_DEFINE_INTEGER_SCANNER_MEMBERS_IMPL(wchar_t, uint128)
+#endif
+
+#define SCN_DEFINE_FIXED_POINT_SCANNER_MEMBERS_IMPL(CharT, T) \
+    template expected<std::ptrdiff_t>                         \
+    fixed_point_scanner<T>::_parse_fixed_point(               \
+        T& val, span<const CharT> s, CharT decimal_point) const;
+
+#define SCN_DEFINE_FIXED_POINT_SCANNER_MEMBERS(Char)                      \
+    SCN_DEFINE_FIXED_POINT_SCANNER_MEMBERS_IMPL(Char, signed char)        \
+    SCN_DEFINE_FIXED_POINT_SCANNER_MEMBERS_IMPL(Char, short)              \
+    SCN_DEFINE_FIXED_POINT_SCANNER_MEMBERS_IMPL(Char, int)                \
+    SCN_DEFINE_FIXED_POINT_SCANNER_MEMBERS_IMPL(Char, long)               \
+    SCN_DEFINE_FIXED_POINT_SCANNER_MEMBERS_IMPL(Char, long long)          \
+    SCN_DEFINE_FIXED_POINT_SCANNER_MEMBERS_IMPL(Char, unsigned char)      \
+    SCN_DEFINE_FIXED_POINT_SCANNER_MEMBERS_IMPL(Char, unsigned short)     \
+    SCN_DEFINE_FIXED_POINT_SCANNER_MEMBERS_IMPL(Char, unsigned int)       \
+    SCN_DEFINE_FIXED_POINT_SCANNER_MEMBERS_IMPL(Char, unsigned long)      \
+    SCN_DEFINE_FIXED_POINT_SCANNER_MEMBERS_IMPL(Char, unsigned long long)
+
+        SCN_DEFINE_FIXED_POINT_SCANNER_MEMBERS(char)
+        SCN_DEFINE_FIXED_POINT_SCANNER_MEMBERS(wchar_t)
+
+#if SCN_HAS_INT128
+        SCN_DEFINE_FIXED_POINT_SCANNER_MEMBERS_IMPL(char, int128)
+        SCN_DEFINE_FIXED_POINT_SCANNER_MEMBERS_IMPL(char, uint128)
+        SCN_DEFINE_FIXED_POINT_SCANNER_MEMBERS_IMPL(wchar_t, int128)
+        SCN_DEFINE_FIXED_POINT_SCANNER_MEMBERS_IMPL(wchar_t, uint128)
+#endif
+
 #endif
 
     }  // namespace detail
@@ -20,6 +20,10 @@
 #include <istream>
 #include "../test.h"
 
+#if SCN_POSIX
+#include <unistd.h>
+#endif
+
 static bool do_fgets(char* str, size_t count, std::FILE* f)
 {
     return std::fgets(str, static_cast<int>(count), f) != nullptr;
@@ -114,6 +118,110 @@ TEST_CASE_TEMPLATE("file", CharT, char, wchar_t)
         CHECK(std::feof(file.handle()) == 0);
     }
 
+    SUBCASE("block size")
+    {
+        file.set_block_size(4);
+
+        auto result = scn::make_result(file);
+
+        int i;
+        result = scn::scan_default(result.range(), i);
+        CHECK(result);
+        CHECK(i == 123);
+
+        string_type word;
+        result = scn::scan_default(result.range(), word);
+        CHECK(result);
+        CHECK(word == widen<CharT>("word"));
+
+        result = scn::scan_default(result.range(), word);
+        CHECK(result);
+        CHECK(word == widen<CharT>("another"));
+
+        result = scn::scan_default(result.range(), word);
+        CHECK(!result);
+        CHECK(result.error().code() == scn::error::end_of_range);
+    }
+    SUBCASE("block size syncing")
+    {
+        file.set_block_size(64);
+
+        int i;
+        auto result = scn::scan_default(file, i);
+        CHECK(result);
+        CHECK(i == 123);
+        file.sync(result.range().begin());
+        result.range().reset_begin_iterator();
+
+        string_type word;
+        result = scn::scan_default(file, word);
+        CHECK(result);
+        CHECK(word == widen<CharT>("word"));
+        file.sync(result.range().begin());
+
+        word = widen<CharT>(" another");
+
+        std::vector<CharT> buf(word.size() + 1, 0);
+        bool fgets_ret = do_fgets(buf.data(), buf.size(), file.handle());
+        CHECK(fgets_ret);
+        CHECK(word == string_type{buf.data()});
+        CHECK(std::ferror(file.handle()) == 0);
+    }
+
+    SUBCASE("windowed")
+    {
+        file.set_windowed(true);
+
+        int i;
+        auto result = scn::scan_default(file, i);
+        CHECK(result);
+        CHECK(i == 123);
+
+        // the file remembers where the previous scan ended
+        string_type word;
+        result = scn::scan_default(file, word);
+        CHECK(result);
+        CHECK(word == widen<CharT>("word"));
+        file.sync();
+
+        word = widen<CharT>(" another");
+
+        std::vector<CharT> buf(word.size() + 1, 0);
+        bool fgets_ret = do_fgets(buf.data(), buf.size(), file.handle());
+        CHECK(fgets_ret);
+        CHECK(word == string_type{buf.data()});
+        CHECK(std::ferror(file.handle()) == 0);
+    }
+    SUBCASE("windowed with block size")
+    {
+        file.set_windowed(true);
+        file.set_block_size(3);
+
+        auto result = scn::make_result(file);
+
+        int i;
+        result = scn::scan_default(result.range(), i);
+        CHECK(result);
+        CHECK(i == 123);
+
+        string_type word;
+        result = scn::scan_default(result.range(), word);
+        CHECK(result);
+        CHECK(word == widen<CharT>("word"));
+
+        result = scn::scan_default(result.range(), i);
+        CHECK(!result);
+        CHECK(result.error().code() == scn::error::invalid_scanned_value);
+
+        result = scn::scan_default(result.range(), word);
+        CHECK(result);
+        CHECK(word == widen<CharT>("another"));
+
+        result = scn::scan_default(result.range(), word);
+        CHECK(!result);
+        CHECK(result.error().code() == scn::error::end_of_range);
+    }
+
     SUBCASE("error")
     {
         int i;
@@ -149,6 +257,45 @@ TEST_CASE_TEMPLATE("file", CharT, char, wchar_t)
         CHECK(result.error().code() == scn::error::end_of_range);
         CHECK(line == widen<CharT>("word another"));
     }
+    SUBCASE("getline with block size")
+    {
+        file.set_block_size(64);
+
+        string_type line;
+        auto result = scn::getline(file, line);
+        CHECK(result);
+        CHECK(line == widen<CharT>("123"));
+
+        result = scn::getline(result.range(), line);
+        CHECK(result);
+        CHECK(line == widen<CharT>("word another"));
+
+        result = scn::getline(result.range(), line);
+        CHECK(!result);
+        CHECK(result.error().code() == scn::error::end_of_range);
+    }
+    SUBCASE("ignore_until with block size")
+    {
+        file.set_block_size(4);
+
+        auto result = scn::ignore_until_n(
+            file, 2, scn::detail::ascii_widen<CharT>('\n'));
+        CHECK(result);
+
+        int i;
+        result = scn::scan_default(result.range(), i);
+        CHECK(result);
+        CHECK(i == 3);
+
+        result = scn::ignore_until(result.range(),
+                                   scn::detail::ascii_widen<CharT>(' '));
+        CHECK(result);
+
+        string_type word;
+        result = scn::scan_default(result.range(), word);
+        CHECK(result);
+        CHECK(word == widen<CharT>("another"));
+    }
 }
 
 TEST_CASE("mapped file")
@@ -186,7 +333,215 @@ TEST_CASE("mapped file")
         CHECK(result.error().code() == scn::error::end_of_range);
         CHECK(word == "another");
     }
+    SUBCASE("hints")
+    {
+        file = scn::mapped_file{
+            "./test/file/testfile.txt",
+            scn::map_sequential | scn::map_populate | scn::map_huge_pages};
+        REQUIRE(file.valid());
+
+        int i;
+        auto result = scn::scan_default(file, i);
+        CHECK(result);
+        CHECK(i == 123);
+    }
+    SUBCASE("release_until")
+    {
+        auto result = scn::make_result(file);
+
+        int i;
+        result = scn::scan_default(result.range(), i);
+        CHECK(result);
+        CHECK(i == 123);
+        file.release_until(result.range().begin());
+        file.release_until(file.end());
+
+        // released pages can still be read
+        result = scn::scan_default(file, i);
+        CHECK(result);
+        CHECK(i == 123);
+    }
+}
+
+TEST_CASE("windowed mapped file")
+{
+    SUBCASE("small file")
+    {
+        scn::windowed_mapped_file file{"./test/file/testfile.txt", 1};
+        REQUIRE(file.valid());
+
+        int i;
+        auto result = scn::scan_default(file, i);
+        CHECK(result);
+        CHECK(i == 123);
+
+        // the file remembers where the previous scan ended
+        std::string word;
+        result = scn::scan_default(file, word);
+        CHECK(result);
+        CHECK(word == "word");
+
+        result = scn::scan_default(file, word);
+        CHECK(result);
+        CHECK(word == "another");
+
+        result = scn::scan_default(file, word);
+        CHECK(!result);
+        CHECK(result.error().code() == scn::error::end_of_range);
+    }
+    SUBCASE("multiple windows")
+    {
+        const char* filename = "./test/file/windowed_testfile.txt";
+        {
+            auto f = std::fopen(filename, "w");
+            REQUIRE(f);
+            for (int i = 0; i < 10000; ++i) {
+                std::fprintf(f, "%d ", i);
+            }
+            // longer than the window size
+            std::fputs(std::string(20000, 'a').c_str(), f);
+            std::fclose(f);
+        }
+
+        // rounded up to the page size
+        scn::windowed_mapped_file file{filename, 1};
+        REQUIRE(file.valid());
+        CHECK(file.window_size() < file.file_size());
+
+        auto result = scn::make_result(file);
+        int i, expected = 0;
+        while ((result = scn::scan_default(result.range(), i))) {
+            CHECK(i == expected);
+            ++expected;
+        }
+        CHECK(expected == 10000);
+
+        std::string word;
+        result = scn::scan_default(result.range(), word);
+        CHECK(result);
+        CHECK(word == std::string(20000, 'a'));
+
+        file = scn::windowed_mapped_file{};
+        std::remove(filename);
+    }
+}
+
+#if SCN_POSIX
+static scn::detail::native_file_handle make_pipe(const std::string& content)
+{
+    int fds[2];
+    REQUIRE(::pipe(fds) == 0);
+    REQUIRE(::write(fds[1], content.data(), content.size()) ==
+            static_cast<ssize_t>(content.size()));
+    ::close(fds[1]);
+    return {fds[0]};
+}
+
+TEST_CASE("fd range")
+{
+    auto h = make_pipe("123 word\nanother 456 longerword");
+
+    SUBCASE("internal buffer")
+    {
+        scn::fd_range range{h};
+        REQUIRE(range.valid());
+
+        int i;
+        std::string word;
+        auto result = scn::scan_default(range, i, word);
+        CHECK(result);
+        CHECK(i == 123);
+        CHECK(word == "word");
+
+        // the range remembers where the previous scan ended
+        result = scn::scan_default(range, word, i);
+        CHECK(result);
+        CHECK(word == "another");
+        CHECK(i == 456);
+
+        result = scn::scan_default(range, word);
+        CHECK(result);
+        CHECK(word == "longerword");
+
+        result = scn::scan_default(range, word);
+        CHECK(!result);
+        CHECK(result.error().code() == scn::error::end_of_range);
+    }
+    SUBCASE("caller-supplied buffer")
+    {
+        char buf[4];
+        scn::fd_range range{h, scn::make_span(buf, 4)};
+
+        auto result = scn::make_result(range);
+
+        int i;
+        result = scn::scan_default(result.range(), i);
+        CHECK(result);
+        CHECK(i == 123);
+
+        std::string line;
+        result = scn::getline(result.range(), line);
+        CHECK(result);
+        CHECK(line == " word");
+
+        std::string word;
+        result = scn::scan_default(result.range(), word, i);
+        CHECK(result);
+        CHECK(word == "another");
+        CHECK(i == 456);
+
+        // doesn't fit in buf
+        result = scn::scan_default(result.range(), word);
+        CHECK(result);
+        CHECK(word == "longerword");
+
+        result = scn::scan_default(result.range(), word);
+        CHECK(!result);
+        CHECK(result.error().code() == scn::error::end_of_range);
+    }
+    SUBCASE("rollback")
+    {
+        char buf[4];
+        scn::fd_range range{h, scn::make_span(buf, 4)};
+
+        int i;
+        auto result = scn::scan_default(range, i);
+        CHECK(result);
+        CHECK(i == 123);
+
+        result = scn::scan_default(range, i);
+        CHECK(!result);
+        CHECK(result.error().code() == scn::error::invalid_scanned_value);
+
+        std::string word;
+        result = scn::scan_default(range, word);
+        CHECK(result);
+        CHECK(word == "word");
+    }
+
+    ::close(h.handle);
+}
+
+TEST_CASE("wide fd range")
+{
+    const auto content = std::wstring{L"123 word"};
+    auto h = make_pipe(
+        std::string(reinterpret_cast<const char*>(content.data()),
+                    content.size() * sizeof(wchar_t)));
+
+    wchar_t buf[2];
+    scn::wfd_range range{h, scn::make_span(buf, 2)};
+
+    int i;
+    std::wstring word;
+    auto result = scn::scan_default(range, i, word);
+    CHECK(result);
+    CHECK(i == 123);
+    CHECK(word == L"word");
+
+    ::close(h.handle);
 }
+#endif
 
 struct int_and_string {
     int i;
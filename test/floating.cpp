@@ -17,6 +17,8 @@
 
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include <cmath>
+#include <cstdlib>
+#include <limits>
 
 #include "test.h"
 
@@ -114,6 +116,22 @@ TEST_CASE_TEMPLATE_DEFINE("floating point", T, floating_test)
         CHECK(!e);
         CHECK(e.error() == scn::error::value_out_of_range);
     }
+    {
+        value_type f{};
+        auto e = do_scan<char_type>(
+            "3.14159265358979323846264338327950288419716939937510582097494459"
+            "2307816406286208998628034825342117067982148086513282306647",
+            "{}", f);
+        CHECK(f == doctest::Approx(3.14159265358979));
+        CHECK(e);
+    }
+    {
+        value_type f{};
+        auto e = do_scan<char_type>("1.25e2x", "{}", f);
+        CHECK(f == doctest::Approx(125.0));
+        CHECK(e);
+        CHECK(e.range_as_string() == widen<char_type>("x"));
+    }
     {
         value_type f{1.0};
         auto e = do_scan<char_type>("str", "{}", f);
@@ -263,6 +281,115 @@ TEST_CASE_TEMPLATE("non-contiguous", CharT, char, wchar_t)
     CHECK(f == doctest::Approx(3.14));
 }
 
+TEST_CASE("wide float followed by non-ASCII")
+{
+    double d{};
+    auto ret = scn::scan(L"2.5\u00e9 1", L"{}", d);
+    CHECK(ret);
+    CHECK(d == doctest::Approx(2.5));
+    CHECK(ret.range_as_string() == L"\u00e9 1");
+
+    ret = scn::scan(L"\u00e92.5", L"{}", d);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_scanned_value);
+}
+
+TEST_CASE("hexfloat")
+{
+    double d{};
+    auto ret = scn::scan("0x1.8p3", "{:a}", d);
+    CHECK(ret);
+    CHECK(d == 12.0);
+
+    ret = scn::scan("-0X1.FFFFFFFFFFFFFp1023", "{}", d);
+    CHECK(ret);
+    CHECK(d == -std::numeric_limits<double>::max());
+
+    ret = scn::scan("0x0.0000000000001p-1022", "{}", d);
+    CHECK(ret);
+    CHECK(d == std::numeric_limits<double>::denorm_min());
+
+    // rounding, ties to even
+    ret = scn::scan("0x1.00000000000008p0", "{}", d);
+    CHECK(ret);
+    CHECK(d == 1.0);
+    ret = scn::scan("0x1.00000000000018p0", "{}", d);
+    CHECK(ret);
+    CHECK(d == 1.0 + 2 * std::numeric_limits<double>::epsilon());
+    ret = scn::scan("0x1.000000000000080000000000000001p0", "{}", d);
+    CHECK(ret);
+    CHECK(d == 1.0 + std::numeric_limits<double>::epsilon());
+
+    // trailing characters aren't a part of the value
+    ret = scn::scan("0x10p-2q", "{}", d);
+    CHECK(ret);
+    CHECK(d == 4.0);
+    CHECK(ret.range_as_string() == "q");
+    ret = scn::scan("0x1.8px", "{}", d);
+    CHECK(ret);
+    CHECK(d == 1.5);
+    CHECK(ret.range_as_string() == "px");
+
+    ret = scn::scan("0x1p1024", "{}", d);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::value_out_of_range);
+    ret = scn::scan("0x1p-1100", "{}", d);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::value_out_of_range);
+
+    float f{};
+    ret = scn::scan("0x1.fffffep127", "{}", f);
+    CHECK(ret);
+    CHECK(f == std::numeric_limits<float>::max());
+    ret = scn::scan("0x1.ffffffp127", "{}", f);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::value_out_of_range);
+
+    auto wret = scn::scan(L"0x.4p4", L"{}", f);
+    CHECK(wret);
+    CHECK(f == 4.0f);
+}
+
+TEST_CASE("long double")
+{
+    // Values on both sides of the fast path limits:
+    // the results have to be the same as with strtold
+    const char* inputs[] = {"0.1",
+                            "3.14159265358979323846",
+                            "-2.5e-3",
+                            "1e27",
+                            "1e28",
+                            "1e-27",
+                            "1e-28",
+                            "1234567890123456789",
+                            "12345678901234567891",
+                            "1234567890123456789000000",
+                            "0.0000000000000000000000000001",
+                            "1.7976931348623157e308",
+                            "1e4000",
+                            "-0"};
+    for (auto input : inputs) {
+        CAPTURE(input);
+        long double ld{};
+        auto ret = scn::scan(scn::string_view{input}, "{}", ld);
+        CHECK(ret);
+        CHECK(ret.empty());
+        CHECK(ld == std::strtold(input, nullptr));
+        CHECK(std::signbit(ld) == std::signbit(std::strtold(input, nullptr)));
+    }
+
+    // an exponent without digits isn't a part of the value
+    long double ld{};
+    auto ret = scn::scan("1.5e+x", "{}", ld);
+    CHECK(ret);
+    CHECK(ld == 1.5L);
+    CHECK(ret.range_as_string() == "e+x");
+
+    ret = scn::scan(".", "{}", ld);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_scanned_value);
+}
+
 TEST_CASE("float error")
 {
     double d{};
@@ -282,6 +409,24 @@ TEST_CASE("parse_float")
     CHECK(d == doctest::Approx(3.14));
 }
 
+TEST_CASE_TEMPLATE("parse_float bounded", T, float, double, long double)
+{
+    // parse_float must not read past the end of the string_view,
+    // whichever backend ends up being used
+    scn::string_view source = "1.5e3";
+    T f{};
+    auto ret = scn::parse_float(source.substr(0, 3), f);
+    CHECK(ret);
+    CHECK(ret.value() == source.begin() + 3);
+    CHECK(f == doctest::Approx(1.5));
+
+    scn::wstring_view wsource = L"2.5e3";
+    auto wret = scn::parse_float(wsource.substr(0, 3), f);
+    CHECK(wret);
+    CHECK(wret.value() == wsource.begin() + 3);
+    CHECK(f == doctest::Approx(2.5));
+}
+
 TEST_CASE("consistency")
 {
     SUBCASE("simple")
@@ -527,6 +527,157 @@ TEST_CASE("integer thousands separator")
         CHECK(ret);
         CHECK(a == 100200);
     }
+
+    SUBCASE("multiple groups")
+    {
+        auto ret = scn::scan("-1,234,567 89", "{:'} {}", a, b);
+        CHECK(ret);
+        CHECK(a == -1234567);
+        CHECK(b == 89);
+
+        auto source = get_deque<char>("1,234,567 89");
+        auto dret = scn::scan(source, "{:'} {}", a, b);
+        CHECK(dret);
+        CHECK(a == 1234567);
+        CHECK(b == 89);
+    }
+
+    SUBCASE("separator not between digits")
+    {
+        auto ret = scn::scan("123,", "{:'}", a);
+        CHECK(ret);
+        CHECK(a == 123);
+        CHECK(ret.range_as_string() == ",");
+
+        ret = scn::scan("123,,4", "{:'}", a);
+        CHECK(ret);
+        CHECK(a == 123);
+        CHECK(ret.range_as_string() == ",,4");
+
+        ret = scn::scan(",123", "{:'}", a);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::invalid_scanned_value);
+    }
+    SUBCASE("sign without digits")
+    {
+        a = 42;
+        auto ret = scn::scan("- 5", "{:'}", a);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::invalid_scanned_value);
+
+        ret = scn::scan("-,5", "{:'}", a);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::invalid_scanned_value);
+        CHECK(a == 42);
+    }
+
+    SUBCASE("overflow")
+    {
+        auto ret = scn::scan("2,147,483,647", "{:'}", a);
+        CHECK(ret);
+        CHECK(a == 2147483647);
+
+        ret = scn::scan("2,147,483,648", "{:'}", a);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::value_out_of_range);
+    }
+}
+
+namespace {
+    struct grouping_numpunct : std::numpunct<char> {
+        char do_thousands_sep() const override
+        {
+            return ' ';
+        }
+        std::string do_grouping() const override
+        {
+            return "\3";
+        }
+    };
+
+    struct fullwidth_ctype : std::ctype<wchar_t> {
+        wchar_t do_widen(char c) const override
+        {
+            if (c >= '0' && c <= '9') {
+                return static_cast<wchar_t>(0xff10 + (c - '0'));
+            }
+            if (c == '-') {
+                return static_cast<wchar_t>(0xff0d);
+            }
+            return std::ctype<wchar_t>::do_widen(c);
+        }
+        const char* do_widen(const char* lo,
+                             const char* hi,
+                             wchar_t* to) const override
+        {
+            for (; lo != hi; ++lo, ++to) {
+                *to = do_widen(*lo);
+            }
+            return hi;
+        }
+    };
+}  // namespace
+
+TEST_CASE("localized integer")
+{
+    const auto loc = std::locale(std::locale::classic(), new grouping_numpunct);
+    int i{};
+
+    SUBCASE("grouping")
+    {
+        auto ret = scn::scan_localized(loc, "-1 234 567", "{:n}", i);
+        CHECK(ret);
+        CHECK(i == -1234567);
+        CHECK(ret.range().empty());
+
+        ret = scn::scan_localized(loc, "1234567", "{:n}", i);
+        CHECK(ret);
+        CHECK(i == 1234567);
+    }
+    SUBCASE("invalid grouping")
+    {
+        i = 0;
+        auto ret = scn::scan_localized(loc, "12 34", "{:n}", i);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::invalid_scanned_value);
+
+        ret = scn::scan_localized(loc, "1234 567", "{:n}", i);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::invalid_scanned_value);
+        CHECK(i == 0);
+    }
+    SUBCASE("separator after the number")
+    {
+        auto ret = scn::scan_localized(loc, "123 x", "{:n}", i);
+        CHECK(ret);
+        CHECK(i == 123);
+        CHECK(ret.range_as_string() == " x");
+    }
+    SUBCASE("sign without digits")
+    {
+        i = 42;
+        auto ret = scn::scan_localized(loc, "-", "{:n}", i);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::invalid_scanned_value);
+
+        ret = scn::scan_localized(loc, "+x", "{:n}", i);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::invalid_scanned_value);
+
+        ret = scn::scan_localized(loc, "-,5", "{:n}", i);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::invalid_scanned_value);
+        CHECK(i == 42);
+    }
+    SUBCASE("non-ASCII digits")
+    {
+        const auto wloc = std::locale(std::locale::classic(), new fullwidth_ctype);
+        auto ret = scn::scan_localized(wloc, L"\xff0d\xff11\xff12\xff13 4",
+                                       L"{:n}", i);
+        CHECK(ret);
+        CHECK(i == -123);
+        CHECK(ret.range().size() == 2);
+    }
 }
 
 TEST_CASE("parse_integer")
@@ -837,6 +988,252 @@ TEST_CASE("trailing")
     CHECK(ret.range_as_string_view()[0] == ';');
 }
 
+TEST_CASE("long digit runs")
+{
+    SUBCASE("unsigned long long")
+    {
+        unsigned long long u{};
+        auto ret = scn::scan_default("18446744073709551615", u);
+        CHECK(ret);
+        CHECK(u == std::numeric_limits<unsigned long long>::max());
+
+        ret = scn::scan_default("18446744073709551616", u);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::value_out_of_range);
+
+        ret = scn::scan("000000000000000000000000012345678901", "{:d}", u);
+        CHECK(ret);
+        CHECK(u == 12345678901ull);
+    }
+    SUBCASE("long long")
+    {
+        long long i{};
+        auto ret = scn::scan_default("-9223372036854775808", i);
+        CHECK(ret);
+        CHECK(i == std::numeric_limits<long long>::min());
+
+        ret = scn::scan_default("9223372036854775807", i);
+        CHECK(ret);
+        CHECK(i == std::numeric_limits<long long>::max());
+
+        ret = scn::scan_default("9223372036854775808", i);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::value_out_of_range);
+    }
+    SUBCASE("int")
+    {
+        int i{};
+        auto ret = scn::scan_default("2147483647", i);
+        CHECK(ret);
+        CHECK(i == 2147483647);
+
+        ret = scn::scan_default("2147483648", i);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::value_out_of_range);
+
+        ret = scn::scan_default("12345678a9", i);
+        CHECK(ret);
+        CHECK(i == 12345678);
+        CHECK(ret.range_as_string() == "a9");
+
+        ret = scn::scan_default("1234567/90", i);
+        CHECK(ret);
+        CHECK(i == 1234567);
+        CHECK(ret.range_as_string() == "/90");
+    }
+    SUBCASE("leading zeroes")
+    {
+        short i{};
+        auto ret = scn::scan("-00000000000000032768", "{:d}", i);
+        CHECK(ret);
+        CHECK(i == -32768);
+
+        ret = scn::scan("0000000000000000000111111111111111", "{:b}", i);
+        CHECK(ret);
+        CHECK(i == 32767);
+    }
+    SUBCASE("boundary length")
+    {
+        short i{};
+        auto ret = scn::scan("-1000000000000000", "{:b}", i);
+        CHECK(ret);
+        CHECK(i == -32768);
+
+        ret = scn::scan("1000000000000000", "{:b}", i);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::value_out_of_range);
+
+        ret = scn::scan("-8001", "{:x}", i);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::value_out_of_range);
+
+        unsigned short u{};
+        ret = scn::scan("ffff", "{:x}", u);
+        CHECK(ret);
+        CHECK(u == 0xffff);
+
+        ret = scn::scan("10000", "{:x}", u);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::value_out_of_range);
+
+        ret = scn::scan("177777", "{:o}", u);
+        CHECK(ret);
+        CHECK(u == 0xffff);
+
+        ret = scn::scan("200000", "{:o}", u);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::value_out_of_range);
+    }
+}
+
+#if SCN_HAS_INT128
+TEST_CASE("128-bit integers")
+{
+    using scn::detail::int128;
+    using scn::detail::uint128;
+
+    const auto u128_max = ~uint128{0};
+    const auto i128_max = static_cast<int128>(u128_max >> 1);
+    const auto i128_min = -i128_max - 1;
+
+    SUBCASE("unsigned")
+    {
+        uint128 u{};
+        auto ret = scn::scan_default(
+            "340282366920938463463374607431768211455", u);
+        CHECK(ret);
+        CHECK(u == u128_max);
+
+        ret = scn::scan_default("340282366920938463463374607431768211456", u);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::value_out_of_range);
+
+        ret = scn::scan("ffffffffffffffffffffffffffffffff", "{:x}", u);
+        CHECK(ret);
+        CHECK(u == u128_max);
+
+        ret = scn::scan("123456789012345678901234567890", "{:d}", u);
+        CHECK(ret);
+        CHECK(u == static_cast<uint128>(123456789012345ull) *
+                           1000000000000000ull +
+                       678901234567890ull);
+
+        ret = scn::scan("0x1234567890abcdef1234567890abcdef", "{:i}", u);
+        CHECK(ret);
+        CHECK(u == ((static_cast<uint128>(0x1234567890abcdefull) << 64) |
+                    0x1234567890abcdefull));
+
+        const auto pow3 = "1" + std::string(50, '0');
+        ret = scn::scan(scn::string_view{pow3}, "{:B3}", u);
+        CHECK(ret);
+        CHECK(u == static_cast<uint128>(12157665459056928801ull) * 59049u);
+    }
+    SUBCASE("signed")
+    {
+        int128 i{};
+        auto ret = scn::scan_default(
+            "170141183460469231731687303715884105727", i);
+        CHECK(ret);
+        CHECK(i == i128_max);
+
+        ret = scn::scan_default("-170141183460469231731687303715884105728",
+                                i);
+        CHECK(ret);
+        CHECK(i == i128_min);
+
+        ret = scn::scan_default("170141183460469231731687303715884105728", i);
+        CHECK(!ret);
+        CHECK(ret.error() == scn::error::value_out_of_range);
+
+        ret = scn::scan_default("-18446744073709551616", i);
+        CHECK(ret);
+        CHECK(i == -static_cast<int128>(uint128{1} << 64));
+
+        ret = scn::scan("-1000", "{:b}", i);
+        CHECK(ret);
+        CHECK(i == -8);
+    }
+    SUBCASE("wide")
+    {
+        uint128 u{};
+        auto ret = scn::scan_default(L"100000000000000000000", u);
+        CHECK(ret);
+        CHECK(u == static_cast<uint128>(10000000000ull) * 10000000000ull);
+    }
+}
+#endif
+
+TEST_CASE("fixed_point")
+{
+    scn::fixed_point<long long, 4> val{};
+
+    auto ret = scn::scan("1234.5678", "{}", val);
+    CHECK(ret);
+    CHECK(val.value == 12345678);
+
+    // missing digits are zeroes
+    ret = scn::scan("-12.5", "{}", val);
+    CHECK(ret);
+    CHECK(val.value == -125000);
+    ret = scn::scan("+7", "{}", val);
+    CHECK(ret);
+    CHECK(val.value == 70000);
+    ret = scn::scan(".25", "{}", val);
+    CHECK(ret);
+    CHECK(val.value == 2500);
+
+    // a decimal point without digits after it isn't a part of the value
+    ret = scn::scan("3.", "{}", val);
+    CHECK(ret);
+    CHECK(val.value == 30000);
+    CHECK(ret.range_as_string() == ".");
+    ret = scn::scan("1.5e3", "{}", val);
+    CHECK(ret);
+    CHECK(val.value == 15000);
+    CHECK(ret.range_as_string() == "e3");
+
+    // extra digits are only allowed, if they're zeroes
+    ret = scn::scan("1.23450000", "{}", val);
+    CHECK(ret);
+    CHECK(val.value == 12345);
+    ret = scn::scan("1.23456", "{}", val);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_scanned_value);
+
+    ret = scn::scan("-922337203685477.5808", "{}", val);
+    CHECK(ret);
+    CHECK(val.value == std::numeric_limits<long long>::min());
+    ret = scn::scan("922337203685477.5808", "{}", val);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::value_out_of_range);
+    ret = scn::scan("-100000000000000000000", "{}", val);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::value_out_of_range);
+
+    ret = scn::scan("-", "{}", val);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_scanned_value);
+
+    scn::fixed_point<unsigned, 2> u{};
+    ret = scn::scan("42949672.95", "{}", u);
+    CHECK(ret);
+    CHECK(u.value == 4294967295u);
+    ret = scn::scan("-1", "{}", u);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_scanned_value);
+
+    scn::fixed_point<int, 2> w{};
+    auto wret = scn::scan(L"-0.07", L"{}", w);
+    CHECK(wret);
+    CHECK(w.value == -7);
+
+    // non-contiguous source
+    auto source = get_deque<char>("19.99 USD");
+    auto dret = scn::scan(source, "{}", w);
+    CHECK(dret);
+    CHECK(w.value == 1999);
+}
+
 TEST_CASE("consistency")
 {
     SUBCASE("simple")
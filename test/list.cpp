@@ -80,3 +80,115 @@ TEST_CASE("comma list until line break")
     CHECK(values.size() == cmp.size());
     CHECK(std::equal(values.begin(), values.end(), cmp.begin()));
 }
+
+TEST_CASE("scan_integers")
+{
+    std::vector<int> values;
+    auto ret = scn::scan_integers("0 1 2\n3 42 -1 +1024 ", values);
+    CHECK(ret);
+    CHECK(ret.value() == 7);
+    CHECK(ret.empty());
+
+    std::vector<int> cmp{0, 1, 2, 3, 42, -1, 1024};
+    CHECK(values == cmp);
+
+    // padded columns
+    values.clear();
+    ret = scn::scan_integers(
+        "          1            22\n"
+        "\t\t\t\t\t\t\t\t\t333 x",
+        values);
+    CHECK(ret);
+    CHECK(ret.value() == 3);
+    CHECK(ret.range_as_string() == "x");
+    CHECK(values == std::vector<int>{1, 22, 333});
+}
+
+TEST_CASE("scan_integers with separator")
+{
+    std::vector<long long> values;
+    auto ret = scn::scan_integers("1,2 , 3 ,4,\n5", values, ',');
+    CHECK(ret);
+    CHECK(ret.value() == 5);
+    CHECK(ret.empty());
+
+    std::vector<long long> cmp{1, 2, 3, 4, 5};
+    CHECK(values == cmp);
+
+    values.clear();
+    ret = scn::scan_integers("1,,2", values, ',');
+    CHECK(ret);
+    CHECK(ret.value() == 1);
+    CHECK(ret.range_as_string() == ",2");
+
+    // a sign without digits doesn't begin an integer
+    values.clear();
+    ret = scn::scan_integers("1 - 2", values, ',');
+    CHECK(ret);
+    CHECK(ret.value() == 1);
+    CHECK(ret.range_as_string() == "- 2");
+
+    values.clear();
+    ret = scn::scan_integers("1 -x 2", values, ',');
+    CHECK(ret);
+    CHECK(ret.value() == 1);
+    CHECK(ret.range_as_string() == "-x 2");
+    CHECK(values == std::vector<long long>{1});
+}
+
+TEST_CASE("scan_integers stop position")
+{
+    std::vector<unsigned> values{42};
+    auto ret = scn::scan_integers("1 2 3 abc 4", values);
+    CHECK(ret);
+    CHECK(ret.value() == 3);
+    CHECK(ret.range_as_string() == "abc 4");
+    CHECK(values == std::vector<unsigned>{42, 1, 2, 3});
+
+    values.clear();
+    ret = scn::scan_integers("1 -2", values);
+    CHECK(ret);
+    CHECK(ret.value() == 1);
+    CHECK(ret.range_as_string() == "-2");
+
+    values.clear();
+    ret = scn::scan_integers("1 99999999999 2", values);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::value_out_of_range);
+    CHECK(ret.range_as_string() == "99999999999 2");
+    CHECK(values == std::vector<unsigned>{1});
+
+    values.clear();
+    ret = scn::scan_integers("", values);
+    CHECK(ret);
+    CHECK(ret.value() == 0);
+}
+
+TEST_CASE("scan_integers into span")
+{
+    std::vector<int> buffer(4, 0);
+    auto ret = scn::scan_integers("1 2 3 4 5", scn::make_span(buffer));
+    CHECK(ret);
+    CHECK(ret.value() == 4);
+    CHECK(ret.range_as_string() == "5");
+    CHECK(buffer[0] == 1);
+    CHECK(buffer[3] == 4);
+
+    ret = scn::scan_integers("6;7", scn::make_span(buffer), ';');
+    CHECK(ret);
+    CHECK(ret.value() == 2);
+    CHECK(ret.empty());
+    CHECK(buffer[0] == 6);
+    CHECK(buffer[1] == 7);
+    CHECK(buffer[2] == 3);
+}
+
+TEST_CASE("scan_integers wide")
+{
+    std::vector<short> values;
+    auto source = std::wstring{L"10\t20\t30"};
+    auto ret = scn::scan_integers(source, values);
+    CHECK(ret);
+    CHECK(ret.value() == 3);
+    CHECK(values == std::vector<short>{10, 20, 30});
+}
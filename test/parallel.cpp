@@ -0,0 +1,234 @@
+// Copyright 2017 Elias Kosunen
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is a part of scnlib:
+//     https://github.com/eliaskosunen/scnlib
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "test.h"
+
+#include <scn/parallel.h>
+
+#include <clocale>
+#include <stdexcept>
+
+TEST_CASE("split_chunks")
+{
+    scn::string_view source{"1\n22\n333\n4444\n55555"};
+    auto s = scn::make_span(source.data(), source.size());
+
+    SUBCASE("one chunk")
+    {
+        auto chunks = scn::split_chunks(s, '\n', 1);
+        REQUIRE(chunks.size() == 1);
+        CHECK(chunks[0].size() == source.size());
+    }
+    SUBCASE("delimiter aligned")
+    {
+        auto chunks = scn::split_chunks(s, '\n', 3);
+        REQUIRE(!chunks.empty());
+        CHECK(chunks.size() <= 3);
+
+        std::string joined;
+        for (auto c : chunks) {
+            REQUIRE(c.size() != 0);
+            if (c.data() + c.size() != s.data() + s.size()) {
+                CHECK(c[c.size() - 1] == '\n');
+            }
+            joined.append(c.data(), c.size());
+        }
+        CHECK(joined == std::string{source.data(), source.size()});
+    }
+    SUBCASE("more chunks than records")
+    {
+        auto chunks = scn::split_chunks(s, '\n', 100);
+        CHECK(chunks.size() == 5);
+    }
+    SUBCASE("no delimiter")
+    {
+        auto chunks = scn::split_chunks(s, ';', 4);
+        REQUIRE(chunks.size() == 1);
+        CHECK(chunks[0].size() == source.size());
+    }
+    SUBCASE("empty")
+    {
+        auto chunks = scn::split_chunks(scn::span<const char>{}, '\n', 4);
+        CHECK(chunks.empty());
+    }
+}
+
+TEST_CASE("scan_chunks")
+{
+    std::string source;
+    long long expected_sum = 0;
+    for (int i = 0; i < 10000; ++i) {
+        source += std::to_string(i);
+        source += '\n';
+        expected_sum += i;
+    }
+
+    auto scan_sum = [](scn::span<const char> chunk) {
+        long long sum = 0;
+        auto result = scn::make_result(chunk);
+        int i;
+        while ((result = scn::scan(result.range(), "{}", i))) {
+            sum += i;
+        }
+        return sum;
+    };
+
+    SUBCASE("sum")
+    {
+        auto sums = scn::scan_chunks(source, '\n', 4, scan_sum);
+        CHECK(sums.size() == 4);
+
+        long long sum = 0;
+        for (auto s : sums) {
+            sum += s;
+        }
+        CHECK(sum == expected_sum);
+    }
+    SUBCASE("more chunks than threads")
+    {
+        auto sums = scn::scan_chunks(source, '\n', 1000, scan_sum);
+        CHECK(sums.size() == 1000);
+
+        long long sum = 0;
+        for (auto s : sums) {
+            sum += s;
+        }
+        CHECK(sum == expected_sum);
+        // the first chunk has the smallest numbers
+        CHECK(sums.front() < sums.back());
+    }
+    SUBCASE("in order")
+    {
+        auto values = scn::scan_chunks(
+            source, '\n', 0, [](scn::span<const char> chunk) {
+                std::vector<int> v;
+                // Not checked here: assertions aren't thread-safe
+                auto ret = scn::scan_list(chunk, v);
+                SCN_UNUSED(ret);
+                return v;
+            });
+
+        int expected = 0;
+        for (const auto& v : values) {
+            for (auto i : v) {
+                CHECK(i == expected);
+                ++expected;
+            }
+        }
+        CHECK(expected == 10000);
+    }
+}
+
+#if SCN_HAS_EXCEPTIONS
+namespace {
+    // Throws when copied for the second time
+    struct throwing_copy {
+        explicit throwing_copy(int& c) : copies(&c) {}
+        throwing_copy(throwing_copy&&) noexcept = default;
+        throwing_copy(const throwing_copy& o) : copies(o.copies)
+        {
+            if (++*copies == 2) {
+                throw std::runtime_error("copy");
+            }
+        }
+
+        int operator()(scn::span<const char> chunk) const
+        {
+            return static_cast<int>(chunk.size());
+        }
+
+        int* copies;
+    };
+}  // namespace
+
+TEST_CASE("scan_chunks with a throwing copy constructor")
+{
+    std::string source;
+    for (int i = 0; i < 1000; ++i) {
+        source += std::to_string(i);
+        source += '\n';
+    }
+
+    // Every thread but the calling one gets a copy of the functor:
+    // with more than two threads, the copy for the second one throws,
+    // after the first one has already started
+    int copies = 0;
+    if (std::thread::hardware_concurrency() > 2) {
+        CHECK_THROWS_AS(
+            scn::scan_chunks(source, '\n', 4, throwing_copy{copies}),
+            std::runtime_error);
+    }
+    else {
+        auto sizes = scn::scan_chunks(source, '\n', 4, throwing_copy{copies});
+        int size = 0;
+        for (auto s : sizes) {
+            size += s;
+        }
+        CHECK(size == static_cast<int>(source.size()));
+    }
+}
+#endif
+
+TEST_CASE("concurrent strtod fallback")
+{
+    // long doubles with more significant digits than the fast path can
+    // handle are parsed with strtold, wide ones after narrowing:
+    // parsing them concurrently must be safe, and
+    // must not depend on or change the global C locale
+    std::string source;
+    std::wstring wsource;
+    for (int i = 0; i < 4000; ++i) {
+        source += std::to_string(i) + ".50000000000000000000001\n";
+        wsource += std::to_wstring(i) + L".50000000000000000000001\n";
+    }
+    const std::string global_locale = std::setlocale(LC_NUMERIC, nullptr);
+
+    auto sums = scn::scan_chunks(
+        source, '\n', 4, [](scn::span<const char> chunk) {
+            long double sum = 0;
+            auto result = scn::make_result(chunk);
+            long double d;
+            while ((result = scn::scan(result.range(), "{}", d))) {
+                sum += d;
+            }
+            return sum;
+        });
+    auto wsums = scn::scan_chunks(
+        wsource, L'\n', 4, [](scn::span<const wchar_t> chunk) {
+            long double sum = 0;
+            auto result = scn::make_result(chunk);
+            long double d;
+            while ((result = scn::scan(result.range(), L"{}", d))) {
+                sum += d;
+            }
+            return sum;
+        });
+
+    long double sum = 0;
+    for (auto s : sums) {
+        sum += s;
+    }
+    long double wsum = 0;
+    for (auto s : wsums) {
+        wsum += s;
+    }
+    // sum of i + 0.5 for i in [0, 4000)
+    CHECK(static_cast<double>(sum) == doctest::Approx(7998000.0 + 2000.0));
+    CHECK(static_cast<double>(wsum) == doctest::Approx(7998000.0 + 2000.0));
+    CHECK(global_locale == std::setlocale(LC_NUMERIC, nullptr));
+}
@@ -128,6 +128,89 @@ TEST_CASE("mapped_file")
         "");
 }
 
+TEST_CASE("range_wrapper copy and move")
+{
+    SUBCASE("owning")
+    {
+        auto range = scn::wrap(std::string{"123 456"});
+        range.advance(4);
+
+        auto copy = range;
+        CHECK(*copy.begin() == '4');
+        CHECK(copy.begin() - copy.begin_underlying() == 4);
+
+        auto moved = std::move(copy);
+        CHECK(*moved.begin() == '4');
+        CHECK(moved.begin() == moved.begin_underlying() + 4);
+    }
+    SUBCASE("owning, by value")
+    {
+        // Copyable and default constructible, so the ranges polyfill
+        // considers it a view, but it owns its characters
+        struct inline_buffer {
+            const char* begin() const
+            {
+                return data;
+            }
+            const char* end() const
+            {
+                return data + size;
+            }
+
+            char data[8];
+            std::size_t size;
+        };
+
+        auto range = scn::wrap(inline_buffer{"123 456", 7});
+        range.advance(4);
+
+        auto copy = range;
+        CHECK(*copy.begin() == '4');
+        CHECK(copy.begin() == copy.begin_underlying() + 4);
+
+        auto moved = std::move(copy);
+        CHECK(*moved.begin() == '4');
+        CHECK(moved.begin() == moved.begin_underlying() + 4);
+    }
+    SUBCASE("view")
+    {
+        auto range = scn::wrap("123 456");
+        range.advance(4);
+
+        auto copy = range;
+        CHECK(copy.begin() == range.begin());
+
+        auto moved = std::move(copy);
+        CHECK(moved.begin() == range.begin());
+    }
+    SUBCASE("reference")
+    {
+        auto f = std::tmpfile();
+        REQUIRE(f);
+        std::fputs("123 456", f);
+        std::rewind(f);
+
+        auto file = scn::file{f};
+        auto range = scn::wrap(file);
+        // Comparing with end() reads the next character
+        for (int i = 0; i < 4; ++i) {
+            REQUIRE(range.begin() != range.end());
+            range.advance();
+        }
+        REQUIRE(range.begin() != range.end());
+
+        auto copy = range;
+        CHECK((*copy.begin()).value() == '4');
+        CHECK(copy.begin() == range.begin());
+
+        auto moved = std::move(copy);
+        CHECK((*moved.begin()).value() == '4');
+        CHECK(moved.begin() == range.begin());
+
+        std::fclose(f);
+    }
+}
+
 TEST_CASE("get_buffer")
 {
     std::string first{"123"}, second{"456"};
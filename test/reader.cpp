@@ -397,6 +397,42 @@ TEST_CASE_TEMPLATE("read_until_space_zero_copy keep final space",
     }
 }
 
+TEST_CASE_TEMPLATE("read_until_space_zero_copy long words",
+                   CharT,
+                   char,
+                   wchar_t)
+{
+    auto locale = scn::make_default_locale_ref<CharT>();
+    auto pred = scn::detail::make_is_space_predicate(locale, false);
+
+    const auto spaces = widen<CharT>(" \t\n\v\f\r");
+    for (std::size_t n = 1; n < 40; ++n) {
+        CAPTURE(n);
+        const auto space = spaces[n % spaces.size()];
+        std::basic_string<CharT> source(n,
+                                        scn::detail::ascii_widen<CharT>('a'));
+        source.push_back(space);
+        source += widen<CharT>("bc");
+
+        auto range = scn::wrap(source);
+        auto ret = scn::read_until_space_zero_copy(range, pred, false);
+        CHECK(ret);
+        CHECK(ret.value().size() == n);
+        CHECK(*range.begin() == space);
+
+        range = scn::wrap(source);
+        ret = scn::read_until_space_zero_copy(range, pred, true);
+        CHECK(ret);
+        CHECK(ret.value().size() == n + 1);
+        CHECK(ret.value()[n] == space);
+
+        ret = scn::read_until_space_zero_copy(range, pred, true);
+        CHECK(ret);
+        CHECK(ret.value().size() == 2);
+        CHECK(range.begin() == range.end());
+    }
+}
+
 TEST_CASE("putback_n")
 {
     SUBCASE("contiguous")
@@ -419,3 +455,33 @@ TEST_CASE("putback_n")
         CHECK(*range.begin() == 'a');
     }
 }
+
+TEST_CASE_TEMPLATE("skip whitespace", CharT, char, wchar_t)
+{
+    const auto spaces = widen<CharT>(" \t\n\v\f\r");
+    for (std::size_t n = 0; n < 40; ++n) {
+        CAPTURE(n);
+        std::basic_string<CharT> source{};
+        for (std::size_t i = 0; i < n; ++i) {
+            source.push_back(spaces[i % spaces.size()]);
+        }
+        source += widen<CharT>("123 x");
+
+        int i{};
+        auto ret = scn::scan_default(source, i);
+        CHECK(ret);
+        CHECK(i == 123);
+        CHECK(ret.range_as_string() == widen<CharT>(" x"));
+    }
+
+    // only whitespace -> EOF
+    int i{};
+    auto ret = scn::scan_default(widen<CharT>("                     \n"), i);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::end_of_range);
+
+    // not a space in the "C" locale
+    ret = scn::scan_default(widen<CharT>("        \x01 123"), i);
+    CHECK(!ret);
+    CHECK(ret.error() == scn::error::invalid_scanned_value);
+}
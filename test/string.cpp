@@ -110,6 +110,30 @@ TEST_CASE_TEMPLATE("getline", CharT, char, wchar_t)
         CHECK(ret.empty());
         CHECK(s == widen<CharT>("Second line with spaces"));
     }
+    SUBCASE("long lines")
+    {
+        const auto first =
+            string_type(100, scn::detail::ascii_widen<CharT>('a'));
+        const auto second =
+            string_type(37, scn::detail::ascii_widen<CharT>('b'));
+        const auto source =
+            first + scn::detail::ascii_widen<CharT>('\n') + second;
+
+        string_type s{};
+        auto ret = scn::getline(source, s);
+        CHECK(ret);
+        CHECK(s == first);
+
+        ret = scn::getline(ret.range(), s, scn::make_code_point('\n'));
+        CHECK(ret);
+        CHECK(ret.empty());
+        CHECK(s == second);
+
+        auto deque = get_deque<CharT>(source);
+        auto dret = scn::getline(deque, s);
+        CHECK(dret);
+        CHECK(s == first);
+    }
 }
 
 TEST_CASE_TEMPLATE("ignore", CharT, char, wchar_t)
@@ -18,6 +18,8 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "test.h"
 
+#include <cstdio>
+
 TEST_CASE("set parse")
 {
     scn::locale_ref locale{};
@@ -577,4 +579,124 @@ TEST_CASE("set scanning")
         CHECK(str == "ÅÄ");
         str = "";
     }
+
+    SUBCASE("long string_view")
+    {
+        const auto word = std::string(37, 'x') + "Az_09";
+        const auto source = word + "-" + word;
+        scn::string_view sv;
+        auto ret = scn::scan(source, "{:[a-zA-Z0-9_]}", sv);
+        CHECK(ret);
+        CHECK(std::string{sv.data(), sv.size()} == word);
+        CHECK(ret.range_as_string() == "-" + word);
+
+        ret = scn::scan(source, "{:[^-]}{:[-]}{:[^-]}", sv, sv, sv);
+        CHECK(ret);
+        CHECK(ret.range().empty());
+        CHECK(std::string{sv.data(), sv.size()} == word);
+
+        const auto nonascii = std::string(20, '_') + "\xc3\x84";
+        ret = scn::scan(nonascii, "{:[\\w]}", sv);
+        CHECK(ret);
+        CHECK(sv.size() == 20);
+        CHECK(ret.range_as_string() == "Ä");
+    }
+
+    SUBCASE("overlapping ranges")
+    {
+        std::wstring str;
+        auto ret = scn::scan(
+            L"\u00e9\u4e00\u4f00\u5001z\u0101\u5002", L"{:[\\u4e80-\\u5001"
+            L"\\u00e0-\\u00ffz\\u4e00-\\u4eff\\u0100-\\u0100\\u0101]}",
+            str);
+        CHECK(ret);
+        CHECK(str == L"\u00e9\u4e00\u4f00\u5001z\u0101");
+        CHECK(ret.range_as_string() == L"\u5002");
+
+        ret = scn::scan(L"\u4e7f\u4e80\u5002", L"{:[^\\u4e80-\\u5001]}", str);
+        CHECK(ret);
+        CHECK(str == L"\u4e7f");
+    }
+
+    SUBCASE("many ranges")
+    {
+        const std::vector<std::pair<uint32_t, uint32_t>> ranges = {
+            {0x4e00, 0x9fff},   {0x3040, 0x309f},   {0x30a0, 0x30ff},
+            {0xac00, 0xd7a3},   {0x1f600, 0x1f64f}, {0x1f300, 0x1f5ff},
+            {0x20000, 0x2a6df}, {0x100, 0x17f},     {0x391, 0x3a9},
+            {0x3b1, 0x3c9},     {0xe0, 0xff}};
+        auto encode = [](uint32_t cp) {
+            std::string str;
+            if (cp < 0x80) {
+                str.push_back(static_cast<char>(cp));
+            }
+            else if (cp < 0x800) {
+                str.push_back(static_cast<char>(0xc0 | (cp >> 6)));
+                str.push_back(static_cast<char>(0x80 | (cp & 0x3f)));
+            }
+            else if (cp < 0x10000) {
+                str.push_back(static_cast<char>(0xe0 | (cp >> 12)));
+                str.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3f)));
+                str.push_back(static_cast<char>(0x80 | (cp & 0x3f)));
+            }
+            else {
+                str.push_back(static_cast<char>(0xf0 | (cp >> 18)));
+                str.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3f)));
+                str.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3f)));
+                str.push_back(static_cast<char>(0x80 | (cp & 0x3f)));
+            }
+            return str;
+        };
+
+        std::string format = "{:[";
+        std::vector<uint32_t> code_points{0x41, 0x2fff, 0x10ffff};
+        for (const auto& r : ranges) {
+            char buf[32];
+            std::snprintf(buf, sizeof(buf), "\\U%08x-\\U%08x",
+                          static_cast<unsigned>(r.first),
+                          static_cast<unsigned>(r.second));
+            format += buf;
+            for (auto cp : {r.first - 1, r.first, r.first + 1,
+                            (r.first + r.second) / 2, r.second - 1, r.second,
+                            r.second + 1}) {
+                code_points.push_back(cp);
+            }
+        }
+        format += "]}";
+
+        for (auto cp : code_points) {
+            const bool expected = std::any_of(
+                ranges.begin(), ranges.end(),
+                [cp](const std::pair<uint32_t, uint32_t>& r) {
+                    return cp >= r.first && cp <= r.second;
+                });
+            CAPTURE(cp);
+            const auto source = encode(cp);
+            std::string str;
+            auto ret = scn::scan(source, format, str);
+            CHECK(static_cast<bool>(ret) == expected);
+            CHECK((str == source) == expected);
+        }
+
+        // Long enough for the lookup table to be built mid-token
+        std::string accepted;
+        for (auto cp : code_points) {
+            if (cp > 0xff && std::any_of(ranges.begin(), ranges.end(),
+                                         [cp](const std::pair<uint32_t,
+                                                              uint32_t>& r) {
+                                             return cp >= r.first &&
+                                                    cp <= r.second;
+                                         })) {
+                accepted += encode(cp);
+            }
+        }
+        std::string long_token;
+        for (int i = 0; i < 4; ++i) {
+            long_token += accepted;
+        }
+        std::string str;
+        auto ret = scn::scan(long_token + encode(0x2fff), format, str);
+        CHECK(ret);
+        CHECK(str == long_token);
+    }
 }